@@ -33,7 +33,9 @@
  * - sharg::value_list_validator
  * - sharg::arithmetic_range_validator
  * - sharg::input_file_validator
+ * - sharg::input_file_open_validator (for sharg::input_file_handle)
  * - sharg::output_file_validator
+ * - sharg::output_file_open_validator (for sharg::output_file_handle)
  * - sharg::input_directory_validator
  * - sharg::output_directory_validator
  */
@@ -41,6 +43,12 @@
 #pragma once
 
 #include <sharg/parser.hpp>
+#include <sharg/batch_validation.hpp>
 #include <sharg/auxiliary.hpp>
 #include <sharg/exceptions.hpp>
+#include <sharg/file_handle.hpp>
+#include <sharg/from_chars.hpp>
+#include <sharg/option_schema.hpp>
+#include <sharg/parse_result.hpp>
+#include <sharg/parser_schema.hpp>
 #include <sharg/validators.hpp>
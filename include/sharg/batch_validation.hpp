@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::validate_batch.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sharg/detail/shell_tokenizer.hpp>
+#include <sharg/detail/work_stealing_pool.hpp>
+#include <sharg/parser_schema.hpp>
+
+namespace sharg
+{
+
+/*!\brief The number of command lines and the number of invalid command lines, returned by sharg::validate_batch.
+ * \ingroup parser
+ */
+struct batch_validation_summary
+{
+    //!\brief The number of command lines that were validated.
+    size_t command_lines{0};
+    //!\brief The number of command lines that were invalid.
+    size_t invalid_command_lines{0};
+};
+
+/*!\brief Validates every command line of a manifest against a sharg::parser_schema.
+ * \ingroup parser
+ * \tparam callback_t The type of the callback, see below.
+ * \param[in] schema       The options of the application that is called in the manifest.
+ * \param[in] manifest     The stream to read the command lines from, one per line.
+ * \param[in] on_result    Called for each command line with its line number (1-based), the line and the result.
+ * \param[in] thread_count The number of threads to use (default: all available).
+ * \returns A sharg::batch_validation_summary.
+ *
+ * \details
+ *
+ * Each line is split into arguments like a POSIX shell would do it (see sharg::detail::split_command_line);
+ * the first argument is the program name. Empty lines and lines that only contain a comment (`#`) are skipped.
+ * A line with an unterminated quote is reported as a sharg::parse_error_kind::user_input_error.
+ *
+ * The manifest is read in blocks of lines, so the memory usage does not depend on the size of the manifest.
+ * The lines of a block are validated in parallel using a work stealing thread pool. Afterwards, `on_result` is
+ * called for every line of the block, in the order of the manifest and from the calling thread. A failing line does
+ * not stop the validation. The line and the sharg::parse_result passed to `on_result` are only valid during the call.
+ *
+ * ```cpp
+ * sharg::validate_batch(schema, manifest, [] (size_t line_number, std::string_view, sharg::parse_result const & r)
+ * {
+ *     if (!r)
+ *         std::cerr << "Line " << line_number << ": " << r.message() << '\n';
+ * });
+ * ```
+ */
+template <typename callback_t>
+//!\cond
+    requires std::invocable<callback_t &, size_t, std::string_view, parse_result const &>
+//!\endcond
+batch_validation_summary validate_batch(parser_schema const & schema,
+                                        std::istream & manifest,
+                                        callback_t && on_result,
+                                        size_t const thread_count = std::thread::hardware_concurrency())
+{
+    //!\brief A single line and its result; kept across blocks to reuse the memory.
+    struct command_line
+    {
+        size_t line_number{};
+        std::string line{};
+        std::string buffer{};
+        std::vector<std::string_view> arguments{};
+        parse_result result{};
+    };
+
+    static constexpr size_t block_size{4096};
+
+    detail::work_stealing_pool pool{thread_count};
+    std::vector<command_line> block(block_size);
+    batch_validation_summary summary{};
+    size_t line_number{0};
+
+    auto validate_line = [&] (size_t const index)
+    {
+        command_line & current = block[index];
+        current.arguments.clear();
+
+        if (!detail::split_command_line(current.line, current.buffer, current.arguments))
+        {
+            current.result = parse_result{parse_error_kind::user_input_error, parse_result::npos, {},
+                                          [] (parse_result const &)
+            {
+                return std::string{"The command line contains an unterminated quote or ends with a backslash."};
+            }};
+            return;
+        }
+
+        current.result = schema.validate(current.arguments);
+    };
+
+    while (manifest)
+    {
+        size_t block_lines{0};
+
+        while (block_lines < block_size && std::getline(manifest, block[block_lines].line))
+        {
+            ++line_number;
+            std::string_view const line{block[block_lines].line};
+
+            // skip empty lines and comments without tokenizing them
+            size_t const first = line.find_first_not_of(" \t\r\v\f");
+            if (first == std::string_view::npos || line[first] == '#')
+                continue;
+
+            block[block_lines++].line_number = line_number;
+        }
+
+        pool.run(block_lines, validate_line);
+
+        for (size_t i = 0; i < block_lines; ++i)
+        {
+            summary.invalid_command_lines += !block[i].result.success();
+            on_result(block[i].line_number, std::string_view{block[i].line}, std::as_const(block[i].result));
+        }
+
+        summary.command_lines += block_lines;
+    }
+
+    return summary;
+}
+
+} // namespace sharg
@@ -15,6 +15,7 @@
 #include <concepts>
 
 #include <sharg/enumeration_names.hpp>
+#include <sharg/from_chars.hpp>
 
 namespace sharg
 {
@@ -73,13 +74,14 @@ requires (std::ostream & os, type & con)
  *
  * ### Requirements
  *
- * In order to model this concept, the type must either model sharg::istreamable and sharg::ostreamable or
- * model sharg::named_enumeration<option_type>.
+ * In order to model this concept, the type must either model sharg::istreamable (or sharg::from_chars_parsable) and
+ * sharg::ostreamable or model sharg::named_enumeration<option_type>.
  *
  * \remark For a complete overview, take a look at \ref parser
  */
 template <typename option_type>
-concept parser_compatible_option = (sharg::istreamable<option_type> && sharg::ostreamable<option_type>) ||
+concept parser_compatible_option = ((sharg::istreamable<option_type> || sharg::from_chars_parsable<option_type>) &&
+                                     sharg::ostreamable<option_type>) ||
                                     named_enumeration<option_type>;
 
 } // namespace sharg
@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the character classes of application names, identifiers and version strings.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The character classes that sharg::detail::char_class_table distinguishes; a bit mask.
+ * \ingroup parser
+ */
+enum char_class : uint8_t
+{
+    no_char_class = 0,        //!< Any other character.
+    digit_char = 1 << 0,      //!< `0-9`.
+    letter_char = 1 << 1,     //!< `a-z` and `A-Z`.
+    underscore_char = 1 << 2, //!< `_`.
+    hyphen_char = 1 << 3,     //!< `-`.
+    at_char = 1 << 4,         //!< `@`.
+
+    //!\brief The characters of application and subcommand names: `[a-zA-Z0-9_-]`.
+    app_name_chars = digit_char | letter_char | underscore_char | hyphen_char,
+    //!\brief The characters of short identifiers: `[a-zA-Z0-9_@]`.
+    short_id_chars = digit_char | letter_char | underscore_char | at_char,
+    //!\brief The characters of long identifiers: `[a-zA-Z0-9_@-]`.
+    long_id_chars = short_id_chars | hyphen_char
+};
+
+/*!\brief The sharg::detail::char_class of every character, computed at compile time.
+ * \ingroup parser
+ */
+inline constexpr std::array<uint8_t, 256> char_class_table = [] ()
+{
+    std::array<uint8_t, 256> table{};
+
+    for (char c = '0'; c <= '9'; ++c)
+        table[static_cast<unsigned char>(c)] = digit_char;
+
+    for (char c = 'a'; c <= 'z'; ++c)
+    {
+        table[static_cast<unsigned char>(c)] = letter_char;
+        table[static_cast<unsigned char>(c - 'a' + 'A')] = letter_char;
+    }
+
+    table[static_cast<unsigned char>('_')] = underscore_char;
+    table[static_cast<unsigned char>('-')] = hyphen_char;
+    table[static_cast<unsigned char>('@')] = at_char;
+
+    return table;
+}();
+
+/*!\brief Whether `c` belongs to one of the `classes`.
+ * \ingroup parser
+ */
+constexpr bool is_char_of(char const c, uint8_t const classes) noexcept
+{
+    return (char_class_table[static_cast<unsigned char>(c)] & classes) != 0;
+}
+
+/*!\brief Whether `str` is not empty and only consists of characters of the `classes`.
+ * \ingroup parser
+ */
+constexpr bool consists_of(std::string_view const str, uint8_t const classes) noexcept
+{
+    if (str.empty())
+        return false;
+
+    for (char const c : str)
+        if (!is_char_of(c, classes))
+            return false;
+
+    return true;
+}
+
+/*!\brief Whether `name` is a valid application or subcommand name, i.e. matches the regex `^[a-zA-Z0-9_-]+$`.
+ * \ingroup parser
+ */
+constexpr bool is_valid_app_name(std::string_view const name) noexcept
+{
+    return consists_of(name, app_name_chars);
+}
+
+/*!\brief Returns the length of the version number `major.minor.patch` that `str` starts with, or 0 if there is none.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Equivalent to the length of the match of the regex `^[[:digit:]]+\.[[:digit:]]+\.[[:digit:]]+`, e.g. 6 for
+ * `"3.0.12-rc.1"`.
+ */
+constexpr size_t version_prefix_length(std::string_view const str) noexcept
+{
+    size_t position{0};
+
+    for (size_t number = 0; number < 3; ++number)
+    {
+        if (number > 0)
+        {
+            if (position == str.size() || str[position] != '.')
+                return 0;
+
+            ++position;
+        }
+
+        size_t const begin = position;
+
+        while (position < str.size() && is_char_of(str[position], digit_char))
+            ++position;
+
+        if (position == begin)
+            return 0;
+    }
+
+    return position;
+}
+
+} // namespace sharg::detail
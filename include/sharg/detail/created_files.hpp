@@ -0,0 +1,129 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::created_files.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <sharg/detail/small_function.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The files that validators created during one parse; they are removed again if the parse fails.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * sharg::detail::format_parse installs an instance for the current thread at the beginning of each parse (see
+ * created_files::scope). A validator that creates a file registers how to remove it via created_files::add.
+ * If the parse succeeds, format_parse calls commit() and the files are kept. Otherwise, e.g. if another option is
+ * invalid, the files are removed when the instance is destroyed at the end of the parse.
+ *
+ * Validators that are called outside of a parse (no instance is installed) never remove the files they created.
+ *
+ * A parse that only validates the command line (see sharg::parser_schema) installs an instance with `dry_run` set.
+ * Validators must not create any files then, but only check whether they could (see created_files::is_dry_run).
+ */
+class created_files
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    created_files() = default;                                  //!< Defaulted.
+    created_files(created_files const &) = delete;              //!< Deleted.
+    created_files & operator=(created_files const &) = delete;  //!< Deleted.
+    created_files(created_files &&) = delete;                   //!< Deleted.
+    created_files & operator=(created_files &&) = delete;       //!< Deleted.
+
+    /*!\brief Constructs an instance that may forbid creating files.
+     * \param[in] dry_run Whether validators must not create files, i.e. the parse only validates the command line.
+     */
+    explicit created_files(bool const dry_run) noexcept : only_check{dry_run}
+    {}
+
+    //!\brief Removes the files unless commit() was called.
+    ~created_files()
+    {
+        for (small_function<void()> & remove : removals)
+            remove();
+    }
+    //!\}
+
+    //!\brief Installs an instance for the current thread until the scope ends; the previous one is restored afterwards.
+    class scope
+    {
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        scope() = delete;                          //!< Deleted.
+        scope(scope const &) = delete;             //!< Deleted.
+        scope & operator=(scope const &) = delete; //!< Deleted.
+        scope(scope &&) = delete;                  //!< Deleted.
+        scope & operator=(scope &&) = delete;      //!< Deleted.
+
+        //!\brief Installs `files`.
+        explicit scope(created_files * const files) noexcept : previous{current()}
+        {
+            current() = files;
+        }
+
+        //!\brief Restores the previous instance.
+        ~scope()
+        {
+            current() = previous;
+        }
+        //!\}
+
+    private:
+        //!\brief The instance that was installed before.
+        created_files * previous;
+    };
+
+    //!\brief The instance installed for the current thread or `nullptr`.
+    static created_files *& current() noexcept
+    {
+        thread_local created_files * files{nullptr};
+        return files;
+    }
+
+    /*!\brief Registers a created file with the instance installed for the current thread, if any.
+     * \param[in] remove Removes the file; must not throw.
+     */
+    static void add(small_function<void()> remove)
+    {
+        if (created_files * const files = current(); files != nullptr)
+            files->removals.push_back(std::move(remove));
+    }
+
+    //!\brief Whether the instance installed for the current thread forbids creating files.
+    static bool is_dry_run() noexcept
+    {
+        created_files const * const files = current();
+        return files != nullptr && files->only_check;
+    }
+
+    //!\brief Keeps all files that were registered so far.
+    void commit() noexcept
+    {
+        removals.clear();
+    }
+
+private:
+    //!\brief Remove the registered files.
+    std::vector<small_function<void()>> removals{};
+    //!\brief Whether validators must not create files.
+    bool only_check{false};
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::file_status.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <system_error>
+
+#ifndef _WIN32
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#else
+#   include <fstream>
+#endif
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The metadata of a path that the file validators need, obtained with a single system call.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * std::filesystem::exists, std::filesystem::is_directory and std::filesystem::is_regular_file each query the file
+ * system. file_status::query asks once (`statx` on Linux, `stat` on other POSIX systems) and the validators work on
+ * the result. Like the std::filesystem functions, symbolic links are followed. file_status::readable and
+ * file_status::writable check the permissions without opening or creating a file.
+ */
+struct file_status
+{
+    //!\brief The type of the file.
+    enum class file_type : uint8_t
+    {
+        not_found, //!< The path does not exist.
+        regular,   //!< A regular file.
+        directory, //!< A directory.
+        other      //!< Anything else, e.g. a device or a pipe.
+    };
+
+    //!\brief The type of the file.
+    file_type type{file_type::not_found};
+    //!\brief The device of the file (0 if it does not exist).
+    uint64_t device{0};
+    //!\brief The inode of the file (0 if it does not exist).
+    uint64_t inode{0};
+    //!\brief The size of the file in bytes (0 if it does not exist).
+    uint64_t size{0};
+
+    //!\brief Whether the path exists.
+    bool exists() const noexcept
+    {
+        return type != file_type::not_found;
+    }
+
+    /*!\brief Returns the metadata of `path`.
+     * \param[in] path The path to query.
+     * \throws std::filesystem::filesystem_error if the file system reports an error other than a missing path.
+     */
+    static file_status query(std::filesystem::path const & path)
+    {
+        file_status status{};
+        std::error_code const error = query(path, status);
+
+        if (error)
+            throw std::filesystem::filesystem_error{"Cannot query the status of a path", path, error};
+
+        return status;
+    }
+
+    /*!\brief Stores the metadata of `path` in `status`.
+     * \param[in]  path   The path to query.
+     * \param[out] status The metadata; file_type::not_found if the path does not exist.
+     * \returns The error reported by the file system, if any; a missing path is not an error.
+     */
+    static std::error_code query(std::filesystem::path const & path, file_status & status) noexcept
+    {
+        status = file_status{};
+#if defined(__linux__) && defined(STATX_TYPE)
+        struct statx result{};
+
+        if (statx(AT_FDCWD, path.c_str(), AT_STATX_SYNC_AS_STAT, STATX_TYPE | STATX_INO | STATX_SIZE, &result) != 0)
+            return missing_or_error(errno);
+
+        status.type = type_of(result.stx_mode);
+        status.device = (static_cast<uint64_t>(result.stx_dev_major) << 32) | result.stx_dev_minor;
+        status.inode = result.stx_ino;
+        status.size = result.stx_size;
+#elif !defined(_WIN32)
+        struct stat result{};
+
+        if (stat(path.c_str(), &result) != 0)
+            return missing_or_error(errno);
+
+        status.type = type_of(result.st_mode);
+        status.device = static_cast<uint64_t>(result.st_dev);
+        status.inode = static_cast<uint64_t>(result.st_ino);
+        status.size = static_cast<uint64_t>(result.st_size);
+#else
+        std::error_code error{};
+        std::filesystem::file_status const result = std::filesystem::status(path, error);
+
+        if (result.type() == std::filesystem::file_type::not_found)
+            return {};
+
+        if (error)
+            return error;
+
+        status.type = std::filesystem::is_regular_file(result) ? file_type::regular :
+                      std::filesystem::is_directory(result)    ? file_type::directory : file_type::other;
+
+        if (status.type == file_type::regular)
+            status.size = static_cast<uint64_t>(std::filesystem::file_size(path, error));
+#endif
+        return {};
+    }
+
+    /*!\brief Returns whether the path can be read with the effective user and group id.
+     * \param[in] path The path to check.
+     *
+     * \details
+     *
+     * On POSIX systems this is a single `faccessat` call, i.e. the file is not opened. This avoids the open/close
+     * round-trip of a stream and the locks that opening a file may take on parallel file systems.
+     * For a directory, this checks whether its entries can be listed.
+     */
+    static bool readable(std::filesystem::path const & path) noexcept
+    {
+#ifndef _WIN32
+        return faccessat(AT_FDCWD, path.c_str(), R_OK, AT_EACCESS) == 0;
+#else
+        std::error_code error{};
+
+        if (std::filesystem::is_directory(path, error))
+        {
+            std::filesystem::directory_iterator{path, error};
+            return !error;
+        }
+
+        std::ifstream file{path};
+        return file.is_open() && file.good();
+#endif
+    }
+
+    /*!\brief Returns whether the path can be written with the effective user and group id.
+     * \param[in] path         The path to check.
+     * \param[in] is_directory Whether `path` is a directory in which entries shall be created.
+     *
+     * \details
+     *
+     * Like file_status::readable, this is a single `faccessat` call that does not open or create a file.
+     * For a directory, write and search permission are required to create entries in it.
+     */
+    static bool writable(std::filesystem::path const & path, bool const is_directory = false) noexcept
+    {
+#ifndef _WIN32
+        return faccessat(AT_FDCWD, path.c_str(), is_directory ? (W_OK | X_OK) : W_OK, AT_EACCESS) == 0;
+#else
+        (void) is_directory;
+        std::error_code error{};
+        std::filesystem::perms const permissions = std::filesystem::status(path, error).permissions();
+        return !error && (permissions & std::filesystem::perms::owner_write) != std::filesystem::perms::none;
+#endif
+    }
+
+private:
+#ifndef _WIN32
+    //!\brief Maps the mode bits to a file_type.
+    static file_type type_of(uint32_t const mode) noexcept
+    {
+        return S_ISREG(mode) ? file_type::regular : S_ISDIR(mode) ? file_type::directory : file_type::other;
+    }
+
+    //!\brief A missing path (or a missing directory on the path) is not an error, everything else is.
+    static std::error_code missing_or_error(int const error) noexcept
+    {
+        if (error == ENOENT || error == ENOTDIR)
+            return {};
+
+        return std::error_code{error, std::generic_category()};
+    }
+#endif
+};
+
+} // namespace sharg::detail
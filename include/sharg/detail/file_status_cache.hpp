@@ -0,0 +1,252 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::file_status_cache.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <sharg/detail/file_status.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Caches the file system metadata that the file validators query during one parse.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The file validators do not call sharg::detail::file_status directly but the static functions of this class.
+ * If a cache is installed for the current thread (see file_status_cache::scope), the status and the access
+ * permissions of a path are only queried once; duplicate paths and parent directories shared by several options
+ * cost one system call each. Without an installed cache, the functions query the file system every time.
+ *
+ * Paths are keyed exactly as they are given, i.e. `dir/./file` and `dir/file` are separate entries. They are not
+ * normalised because `link/../file` is not `file` if `link` is a symbolic link to another directory. The cache is
+ * thread-safe, the file validators use it from several threads when checking lists of paths.
+ *
+ * ### Invalidation
+ *
+ * sharg::detail::format_parse installs a new, empty cache at the beginning of each parse and discards it at the end,
+ * so no result outlives the parse it was obtained in. Within a parse, the entries are not invalidated because the
+ * sharg validators only read the file system. Code that modifies the file system while a cache is installed
+ * (e.g. a custom validator that creates a file) must call file_status_cache::invalidate for the affected path or
+ * file_status_cache::invalidate_all.
+ */
+class file_status_cache
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    file_status_cache() = default;                                      //!< Defaulted.
+    file_status_cache(file_status_cache const &) = delete;              //!< Deleted.
+    file_status_cache & operator=(file_status_cache const &) = delete;  //!< Deleted.
+    file_status_cache(file_status_cache &&) = delete;                   //!< Deleted.
+    file_status_cache & operator=(file_status_cache &&) = delete;       //!< Deleted.
+    ~file_status_cache() = default;                                     //!< Defaulted.
+    //!\}
+
+    //!\brief Installs a cache for the current thread until the scope ends; the previous cache is restored afterwards.
+    class scope
+    {
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        scope() = delete;                          //!< Deleted.
+        scope(scope const &) = delete;             //!< Deleted.
+        scope & operator=(scope const &) = delete; //!< Deleted.
+        scope(scope &&) = delete;                  //!< Deleted.
+        scope & operator=(scope &&) = delete;      //!< Deleted.
+
+        //!\brief Installs `cache` (may be `nullptr` to disable caching).
+        explicit scope(file_status_cache * const cache) noexcept : previous{current()}
+        {
+            current() = cache;
+        }
+
+        //!\brief Restores the previous cache.
+        ~scope()
+        {
+            current() = previous;
+        }
+        //!\}
+
+    private:
+        //!\brief The cache that was installed before.
+        file_status_cache * previous;
+    };
+
+    //!\brief The cache installed for the current thread or `nullptr`.
+    static file_status_cache *& current() noexcept
+    {
+        thread_local file_status_cache * cache{nullptr};
+        return cache;
+    }
+
+    /*!\brief Returns the metadata of `path`, see sharg::detail::file_status::query.
+     * \throws std::filesystem::filesystem_error if the file system reports an error other than a missing path.
+     */
+    static file_status status(std::filesystem::path const & path)
+    {
+        file_status result{};
+        std::error_code const error = status(path, result);
+
+        if (error)
+            throw std::filesystem::filesystem_error{"Cannot query the status of a path", path, error};
+
+        return result;
+    }
+
+    //!\brief Stores the metadata of `path` in `result`, see sharg::detail::file_status::query.
+    static std::error_code status(std::filesystem::path const & path, file_status & result)
+    {
+        file_status_cache * const cache = current();
+
+        if (cache == nullptr)
+            return file_status::query(path, result);
+
+        return cache->cached_status(path, result);
+    }
+
+    //!\brief Returns whether `path` is readable, see sharg::detail::file_status::readable.
+    static bool readable(std::filesystem::path const & path)
+    {
+        return access(path, access_kind::read);
+    }
+
+    //!\brief Returns whether `path` is writable, see sharg::detail::file_status::writable.
+    static bool writable(std::filesystem::path const & path, bool const is_directory = false)
+    {
+        return access(path, is_directory ? access_kind::write_directory : access_kind::write);
+    }
+
+    //!\brief Removes the entry of `path` from the cache installed for the current thread, if any.
+    static void invalidate(std::filesystem::path const & path)
+    {
+        if (file_status_cache * const cache = current(); cache != nullptr)
+        {
+            std::lock_guard lock{cache->mutex};
+            cache->entries.erase(key(path));
+        }
+    }
+
+    //!\brief Removes all entries from the cache installed for the current thread, if any.
+    static void invalidate_all()
+    {
+        if (file_status_cache * const cache = current(); cache != nullptr)
+        {
+            std::lock_guard lock{cache->mutex};
+            cache->entries.clear();
+        }
+    }
+
+    //!\brief The number of cached paths.
+    size_t size() const
+    {
+        std::lock_guard lock{mutex};
+        return entries.size();
+    }
+
+private:
+    //!\brief The permissions that are cached.
+    enum access_kind : uint8_t
+    {
+        read,            //!< file_status::readable
+        write,           //!< file_status::writable
+        write_directory, //!< file_status::writable for a directory
+        access_kind_count
+    };
+
+    //!\brief The cached results for a path; -1 means not yet queried.
+    struct entry
+    {
+        //!\brief Whether status and error are set.
+        bool has_status{false};
+        //!\brief The metadata.
+        file_status status{};
+        //!\brief The error of querying the metadata.
+        std::error_code error{};
+        //!\brief The result of the access checks, indexed by access_kind.
+        int8_t access[access_kind_count]{-1, -1, -1};
+    };
+
+    //!\brief The key of a path.
+    static std::string key(std::filesystem::path const & path)
+    {
+        return path.string();
+    }
+
+    //!\brief Returns the cached metadata or queries and caches it.
+    std::error_code cached_status(std::filesystem::path const & path, file_status & result)
+    {
+        std::string path_key = key(path);
+        {
+            std::lock_guard lock{mutex};
+
+            if (auto it = entries.find(path_key); it != entries.end() && it->second.has_status)
+            {
+                result = it->second.status;
+                return it->second.error;
+            }
+        }
+
+        // query without holding the lock; two threads may query the same path, which is harmless
+        std::error_code const error = file_status::query(path, result);
+
+        std::lock_guard lock{mutex};
+        entry & cached = entries[std::move(path_key)];
+        cached.has_status = true;
+        cached.status = result;
+        cached.error = error;
+        return error;
+    }
+
+    //!\brief Returns the cached permission or checks and caches it.
+    static bool access(std::filesystem::path const & path, access_kind const kind)
+    {
+        auto check = [&] ()
+        {
+            return (kind == access_kind::read) ? file_status::readable(path)
+                                               : file_status::writable(path, kind == access_kind::write_directory);
+        };
+
+        file_status_cache * const cache = current();
+
+        if (cache == nullptr)
+            return check();
+
+        std::string path_key = key(path);
+        {
+            std::lock_guard lock{cache->mutex};
+
+            if (auto it = cache->entries.find(path_key); it != cache->entries.end() && it->second.access[kind] != -1)
+                return it->second.access[kind] == 1;
+        }
+
+        bool const allowed = check();
+
+        std::lock_guard lock{cache->mutex};
+        cache->entries[std::move(path_key)].access[kind] = allowed;
+        return allowed;
+    }
+
+    //!\brief Protects entries.
+    mutable std::mutex mutex{};
+    //!\brief The cached results by path.
+    std::unordered_map<std::string, entry> entries{};
+};
+
+} // namespace sharg::detail
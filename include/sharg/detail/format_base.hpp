@@ -63,10 +63,11 @@ protected:
             return "char";
         else if constexpr (std::is_same_v<type, std::string>)
             return "std::string";
-        else if constexpr (std::is_same_v<type, std::filesystem::path>)
+        else if constexpr (std::is_same_v<type, std::filesystem::path> || std::is_same_v<type, input_file_handle> ||
+                           std::is_same_v<type, output_file_handle>)
             return "std::filesystem::path";
         else
-            return sharg::detail::type_name_as_string<value_type>;
+            return sharg::detail::type_name_as_string<value_type>();
     }
 
     /*!\brief Returns the `value_type` of the input container as a string (reflection).
@@ -224,7 +225,7 @@ public:
         std::string info{desc};
         info += ((spec & option_spec::required) ? std::string{" "} : detail::to_string(" Default: ", value, ". "));
         info += option_validator.get_help_page_message();
-        store_help_page_element([this, id, info] () { derived_t().print_list_item(id, info); }, spec);
+        store_help_page_element({help_element_kind::list_item, false, std::move(id), std::move(info)}, spec);
     }
 
     /*!\brief Adds a sharg::print_list_item call to be evaluated later on.
@@ -236,8 +237,7 @@ public:
                   std::string const & desc,
                   option_spec const spec)
     {
-        std::string id = prep_id_for_help(short_id, long_id);
-        store_help_page_element([this, id, desc] () { derived_t().print_list_item(id, desc); }, spec);
+        store_help_page_element({help_element_kind::list_item, false, prep_id_for_help(short_id, long_id), desc}, spec);
     }
 
     /*!\brief Adds a sharg::print_list_item call to be evaluated later on.
@@ -248,19 +248,48 @@ public:
                                std::string const & desc,
                                validator_type & option_validator)
     {
-        std::string msg = option_validator.get_help_page_message();
+        // the value is only inspected when printing, hence the type dependent parts are stored as function pointers
+        positional_option_elements.push_back(
+        {
+            &value,
+            desc,
+            option_validator.get_help_page_message(),
+            [] (void const * value_ptr)
+            {
+                return option_type_and_list_info(*static_cast<option_type const *>(value_ptr));
+            },
+            [] (void const * value_ptr)
+            {
+                // a list at the end may be empty and thus have a default value
+                if constexpr (detail::is_container_option<option_type>)
+                    return detail::to_string(" Default: ", *static_cast<option_type const *>(value_ptr), ". ");
+                else
+                    return std::string{" "};
+            }
+        });
+    }
 
-        positional_option_calls.push_back([this, &value, desc, msg] ()
+    /*!\brief Adds a help page entry for a positional option that hands its values over to a sink.
+     * \copydetails sharg::parser::add_positional_option(sink_type, std::string const &, validator_type)
+     */
+    template <typename value_type, typename sink_type, typename validator_type>
+    void add_positional_sink(sink_type const & /*sink*/,
+                             std::string const & desc,
+                             validator_type & option_validator)
+    {
+        positional_option_elements.push_back(
         {
-            ++positional_option_count;
-            derived_t().print_list_item(detail::to_string("\\fBARGUMENT-", positional_option_count, "\\fP ",
-                                        option_type_and_list_info(value)),
-                                        desc +
-                                        // a list at the end may be empty and thus have a default value
-                                        ((detail::is_container_option<option_type>)
-                                            ? detail::to_string(" Default: ", value, ". ")
-                                            : std::string{" "}) +
-                                        msg);
+            nullptr,
+            desc,
+            option_validator.get_help_page_message(),
+            [] (void const *)
+            {
+                return option_type_and_list_info(std::vector<value_type>{});
+            },
+            [] (void const *)
+            {
+                return std::string{" "};
+            }
         });
     }
 
@@ -300,20 +329,31 @@ public:
         }
 
         // add positional options if specified
-        if (!positional_option_calls.empty())
+        if (!positional_option_elements.empty())
             derived_t().print_section("Positional Arguments");
 
-        // each call will evaluate the function derived_t().print_list_item()
-        for (auto f : positional_option_calls)
-            f();
+        for (positional_option_element const & element : positional_option_elements)
+        {
+            ++positional_option_count;
+            derived_t().print_list_item(detail::to_string("\\fBARGUMENT-", positional_option_count, "\\fP ",
+                                                          element.type_info(element.value)),
+                                        element.desc + element.default_info(element.value) + element.validator_msg);
+        }
 
         // add options and flags if specified
-        if (!parser_set_up_calls.empty())
+        if (!help_page_elements.empty())
             derived_t().print_section("Options");
 
-        // each call will evaluate the function derived_t().print_list_item()
-        for (auto f : parser_set_up_calls)
-            f();
+        for (help_page_element const & element : help_page_elements)
+        {
+            switch (element.kind)
+            {
+                case help_element_kind::section:    derived_t().print_section(element.key); break;
+                case help_element_kind::subsection: derived_t().print_subsection(element.key); break;
+                case help_element_kind::line:       derived_t().print_line(element.key, element.is_paragraph); break;
+                case help_element_kind::list_item:  derived_t().print_list_item(element.key, element.text); break;
+            }
+        }
 
         if (!meta.examples.empty())
         {
@@ -331,36 +371,36 @@ public:
         std::exit(EXIT_SUCCESS); // program should not continue from here
     }
 
-    /*!\brief Adds a print_section call to parser_set_up_calls.
+    /*!\brief Adds a section to help_page_elements.
      * \copydetails sharg::parser::add_section
      */
     void add_section(std::string const & title, option_spec const spec)
     {
-        store_help_page_element([this, title] () { derived_t().print_section(title); }, spec);
+        store_help_page_element({help_element_kind::section, false, title, {}}, spec);
     }
 
-    /*!\brief Adds a print_subsection call to parser_set_up_calls.
+    /*!\brief Adds a subsection to help_page_elements.
      * \copydetails sharg::parser::add_subsection
      */
     void add_subsection(std::string const & title, option_spec const spec)
     {
-        store_help_page_element([this, title] () { derived_t().print_subsection(title); }, spec);
+        store_help_page_element({help_element_kind::subsection, false, title, {}}, spec);
     }
 
-    /*!\brief Adds a print_line call to parser_set_up_calls.
+    /*!\brief Adds a line to help_page_elements.
      * \copydetails sharg::parser::add_line
      */
     void add_line(std::string const & text, bool is_paragraph, option_spec const spec)
     {
-        store_help_page_element([this, text, is_paragraph] () { derived_t().print_line(text, is_paragraph); }, spec);
+        store_help_page_element({help_element_kind::line, is_paragraph, text, {}}, spec);
     }
 
-    /*!\brief Adds a sharg::print_list_item call to parser_set_up_calls.
+    /*!\brief Adds a list item to help_page_elements.
      * \copydetails sharg::parser::add_list_item
      */
     void add_list_item(std::string const & key, std::string const & desc, option_spec const spec)
     {
-        store_help_page_element([this, key, desc] () { derived_t().print_list_item(key, desc); }, spec);
+        store_help_page_element({help_element_kind::list_item, false, key, desc}, spec);
     }
 
     /*!\brief Stores all meta information about the application
@@ -368,7 +408,7 @@ public:
      * \details
      *
      * This needs to be a member of format_parse, because it needs to present
-     * (not filled) when the parser_set_up_calls vector is filled, since all
+     * (not filled) when the help_page_elements vector is filled, since all
      * printing functions need some meta information.
      * The member variable itself is filled when copied over from the parser
      * when calling format_parse::parse. That way all the information needed are
@@ -474,10 +514,47 @@ protected:
         }
     }
 
-    //!\brief Vector of functions that stores all calls except add_positional_option.
-    std::vector<std::function<void()>> parser_set_up_calls;
-    //!\brief Vector of functions that stores add_positional_option calls.
-    std::vector<std::function<void()>> positional_option_calls; // singled out to be printed on top
+    //!\brief The kind of a help_page_element, i.e. which print function is called for it.
+    enum class help_element_kind : uint8_t
+    {
+        section,    //!< Printed via print_section(key).
+        subsection, //!< Printed via print_subsection(key).
+        line,       //!< Printed via print_line(key, is_paragraph).
+        list_item   //!< Printed via print_list_item(key, text).
+    };
+
+    //!\brief An element of the help page that was added by all calls except add_positional_option.
+    struct help_page_element
+    {
+        //!\brief Which print function is called.
+        help_element_kind kind;
+        //!\brief Whether a line is a paragraph.
+        bool is_paragraph;
+        //!\brief The title, the text of a line or the key of a list item.
+        std::string key;
+        //!\brief The description of a list item.
+        std::string text;
+    };
+
+    //!\brief A positional option on the help page. The value is only inspected when printing.
+    struct positional_option_element
+    {
+        //!\brief Points to the bound value.
+        void const * value;
+        //!\brief The description of the positional option.
+        std::string desc;
+        //!\brief The help page message of the validator.
+        std::string validator_msg;
+        //!\brief Returns the type (and list) information of the value.
+        std::string (*type_info)(void const *);
+        //!\brief Returns the default value information of the value.
+        std::string (*default_info)(void const *);
+    };
+
+    //!\brief Stores the help page elements of all calls except add_positional_option.
+    std::vector<help_page_element> help_page_elements;
+    //!\brief Stores the add_positional_option calls.
+    std::vector<positional_option_element> positional_option_elements; // singled out to be printed on top
     //!\brief Keeps track of the number of positional options
     unsigned positional_option_count{0};
     //!\brief The names of subcommand programs.
@@ -486,8 +563,8 @@ protected:
     bool show_advanced_options{true};
 
 private:
-    /*!\brief Adds a function object to parser_set_up_calls **if** the annotation in `spec` does not prevent it.
-     * \param[in] printer The invokable that, if added to `parser_set_up_calls`, prints information to the help page.
+    /*!\brief Adds an element to help_page_elements **if** the annotation in `spec` does not prevent it.
+     * \param[in] element The element that, if added to `help_page_elements`, is printed to the help page.
      * \param[in] spec The option specification deciding whether to add the information to the help page.
      *
      * \details
@@ -496,10 +573,10 @@ private:
      * If `spec` equals `sharg::option_spec::advanced`, the information is only added to the help page if
      * the advanced help page has been queried on the command line (`show_advanced_options == true`).
      */
-    void store_help_page_element(std::function<void()> printer, option_spec const spec)
+    void store_help_page_element(help_page_element element, option_spec const spec)
     {
         if (!(spec & option_spec::hidden) && (!(spec & option_spec::advanced) || show_advanced_options))
-            parser_set_up_calls.push_back(std::move(printer));
+            help_page_elements.push_back(std::move(element));
     }
 };
 
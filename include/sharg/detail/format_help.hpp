@@ -28,7 +28,7 @@ namespace sharg::detail
  * The help page printing is not done immediately, because the user might not
  * provide meta information, positional options, etc. in the correct order.
  * In addition the needed order would be different from the parse format.
- * Thus the calls are stored (parser_set_up_calls and positional_option_calls)
+ * Thus the elements are stored (help_page_elements and positional_option_elements)
  * and only evaluated when calling format_help::parse().
  *
  * \remark For a complete overview, take a look at \ref parser
@@ -12,14 +12,36 @@
 
 #pragma once
 
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+
 #include <sharg/std/charconv>
 
+#include <sharg/detail/created_files.hpp>
+#include <sharg/detail/file_status_cache.hpp>
+#include <sharg/detail/from_chars_integer.hpp>
 #include <sharg/detail/format_base.hpp>
+#include <sharg/detail/small_function.hpp>
 #include <sharg/concept.hpp>
+#include <sharg/option_schema.hpp>
+#include <sharg/parse_result.hpp>
 
 namespace sharg::detail
 {
 
+//!\brief Whether `validator_type` is a sharg::arithmetic_range_validator.
+//!\ingroup parser
+template <typename validator_type>
+inline constexpr bool is_arithmetic_range_validator = false;
+
+//!\cond
+template <typename option_value_t>
+inline constexpr bool is_arithmetic_range_validator<arithmetic_range_validator<option_value_t>> = true;
+//!\endcond
+
 /*!\brief The format that organizes the actual parsing of command line arguments.
  * \ingroup parser
  *
@@ -29,9 +51,11 @@ namespace sharg::detail
  * parameters/options/flags/.. directly (though a variant might work, it is hacky).
  * Directly parsing is also difficult, since the order of parsing options/flags
  * is non trivial (e.g. ambiguousness of '-g 4' => option+value or flag+positional).
- * Therefore, we store the parsing calls of the developer in a function object,
- * (format_parse::option_and_flag_calls, sharg::detail::format_parse::positional_option_calls)
- * executing them in a new order when calling format_parse::parse().
+ * Therefore, we store the parsing calls of the developer in a table of option descriptors
+ * (format_parse::option_table), executing them in a new order when calling format_parse::parse().
+ * Each descriptor holds the identifiers, the option_spec, a pointer to the bound value and a type-erased
+ * parse function that owns the validator (sharg::detail::small_function). The table is a single contiguous vector
+ * and small validators are stored in-place, so setting up the parser does not allocate per option.
  * This enables us to parse any option type and resolve any ambiguousness, so no
  * additional restrictions apply to the developer when setting up the parser.
  *
@@ -43,6 +67,17 @@ namespace sharg::detail
  * When parsing flags and options, the identifiers (and values) are removed from
  * the vector format_parse::argv. That way, options that are specified multiple times,
  * but are no container type, can be identified and an error is reported.
+ * Removed arguments are marked in a bitmap (format_parse::consumed_arguments). Positional options and left over
+ * arguments are then found by a single cursor that only moves forward over this bitmap.
+ *
+ * format_parse::argv only holds std::string_views into the original command line. A std::string is only created
+ * if a value is assigned to an option of type std::string (or if a cluster of short flags needs to be split up).
+ *
+ * Before any option is retrieved, format_parse::argv is tokenized once (see format_parse::build_id_index).
+ * Every argument is classified and the positions of all short and long identifiers are stored in an index,
+ * such that looking up an identifier does not require to rescan all arguments.
+ * If the parser was declared with a sharg::option_schema, long identifiers are looked up via its compile-time
+ * generated perfect hash instead of a hash map that is built on every call.
  *
  * \remark For a complete overview, take a look at \ref parser
  */
@@ -62,9 +97,40 @@ public:
     /*!\brief The constructor of the parse format.
      * \param[in] argc_ The number of command line arguments.
      * \param[in] argv_ The command line arguments to parse.
+     * \param[in] removed_indices The (sorted) indices of arguments in the original `argv` that are not part of
+     *                            `argv_`, e.g. `--version-check` and its value. Used to report argument indices.
+     *
+     * \details
+     *
+     * The arguments are not copied, i.e. the character buffers referred to by `argv_` must outlive this object.
+     */
+    format_parse(int const argc_, std::vector<std::string_view> argv_, std::vector<size_t> removed_indices = {}) :
+        argc{argc_ - 1}, argv{std::move(argv_)}, removed_argument_indices{std::move(removed_indices)}
+    {}
+
+    /*!\brief Creates a parse context that shares the options of `prototype`.
+     * \param[in] prototype The format whose options are used; must outlive this object and must not be modified.
+     * \param[in] argc_ The number of command line arguments.
+     * \param[in] argv_ The command line arguments to parse.
+     * \param[in] removed_indices See above.
+     *
+     * \details
+     *
+     * The option table is not copied, so creating a context only costs the vector of arguments. A context only
+     * validates the command line: values are parsed into copies of the bound variables, which are never modified.
+     * Hence, any number of contexts may parse concurrently.
      */
-    format_parse(int const argc_, std::vector<std::string> argv_) :
-        argc{argc_ - 1}, argv{std::move(argv_)}
+    format_parse(format_parse const & prototype,
+                 int const argc_,
+                 std::vector<std::string_view> argv_,
+                 std::vector<size_t> removed_indices = {}) :
+        shared_option_table{&prototype.descriptors()},
+        positional_option_total{prototype.positional_option_total},
+        store_values{false},
+        argc{argc_ - 1},
+        argv{std::move(argv_)},
+        removed_argument_indices{std::move(removed_indices)},
+        schema{prototype.schema}
     {}
     //!\}
 
@@ -79,10 +145,22 @@ public:
                     option_spec const spec,
                     validator_type && option_validator)
     {
-        option_calls.push_back([this, &value, short_id, long_id, spec, option_validator]()
+        assert(shared_option_table == nullptr); // a parse context cannot be modified
+        option_table.push_back({option_kind::option, short_id, spec, long_id, &value,
+                                [option_validator] (format_parse & fp, option_descriptor const & descriptor)
         {
-            get_option(value, short_id, long_id, spec, option_validator);
-        });
+            auto get_option = [&] (option_type & target)
+            {
+                return fp.get_option(target, descriptor.short_id, descriptor.long_id, descriptor.spec,
+                                     descriptor.list_delimiter, option_validator);
+            };
+
+            if (fp.store_values)
+                return get_option(*static_cast<option_type *>(descriptor.value));
+
+            option_type copy{*static_cast<option_type const *>(descriptor.value)};
+            return get_option(copy);
+        }});
     }
 
     /*!\brief Adds a get_flag call to be evaluated later on.
@@ -92,12 +170,11 @@ public:
                   char const short_id,
                   std::string const & long_id,
                   std::string const & SHARG_DOXYGEN_ONLY(desc),
-                  option_spec const & SHARG_DOXYGEN_ONLY(spec))
+                  option_spec const & spec)
     {
-        flag_calls.push_back([this, &value, short_id, long_id]()
-        {
-            get_flag(value, short_id, long_id);
-        });
+        // flags are not validated, so no parse function is needed
+        assert(shared_option_table == nullptr); // a parse context cannot be modified
+        option_table.push_back({option_kind::flag, short_id, spec, long_id, &value, {}});
     }
 
     /*!\brief Adds a get_positional_option call to be evaluated later on.
@@ -108,34 +185,100 @@ public:
                                std::string const & SHARG_DOXYGEN_ONLY(desc),
                                validator_type && option_validator)
     {
-        positional_option_calls.push_back([this, &value, option_validator]()
+        assert(shared_option_table == nullptr); // a parse context cannot be modified
+        ++positional_option_total;
+        option_table.push_back({option_kind::positional_option, '\0', option_spec::standard, {}, &value,
+                                [option_validator] (format_parse & fp, option_descriptor const & descriptor)
         {
-            get_positional_option(value, option_validator);
-        });
+            if (fp.store_values)
+                return fp.get_positional_option(*static_cast<option_type *>(descriptor.value), option_validator);
+
+            option_type copy{*static_cast<option_type const *>(descriptor.value)};
+            return fp.get_positional_option(copy, option_validator);
+        }});
     }
 
-    //!\brief Initiates the actual command line parsing.
-    void parse(parser_meta_data const & /*meta*/)
+    /*!\brief Adds a get_positional_sink call to be evaluated later on.
+     * \copydetails sharg::parser::add_positional_option(sink_type, std::string const &, validator_type)
+     */
+    template <typename value_type, typename sink_type, typename validator_type>
+    void add_positional_sink(sink_type const & sink,
+                             std::string const & SHARG_DOXYGEN_ONLY(desc),
+                             validator_type && option_validator)
     {
-        end_of_options_it = std::find(argv.begin(), argv.end(), "--");
+        assert(shared_option_table == nullptr); // a parse context cannot be modified
+        ++positional_option_total;
+        option_table.push_back({option_kind::positional_option, '\0', option_spec::standard, {}, nullptr,
+                                [sink, option_validator] (format_parse & fp, option_descriptor const &)
+        {
+            sink_type current_sink{sink}; // the sink may have state, e.g. an output iterator
+            return fp.get_positional_sink<value_type>(current_sink, option_validator);
+        }});
+    }
 
-        // parse options first, because we need to rule out -keyValue pairs
-        // (e.g. -AnoSpaceAfterIdentifierA) before parsing flags
-        for (auto && f : option_calls)
-            f();
+    /*!\brief Sets the delimiter that separates the values of a list option given in a single argument.
+     * \copydetails sharg::parser::set_list_delimiter
+     * \returns `false` if no option with the identifier `id` was added.
+     */
+    template <typename id_type>
+    bool set_list_delimiter(id_type const & id, char const delimiter)
+    {
+        assert(shared_option_table == nullptr); // a parse context cannot be modified
 
-        for (auto && f : flag_calls)
-            f();
+        auto has_id = [&id] (option_descriptor const & descriptor)
+        {
+            if constexpr (std::same_as<id_type, char>)
+                return descriptor.short_id == id;
+            else
+                return descriptor.long_id == id;
+        };
 
-        check_for_unknown_ids();
+        for (option_descriptor & descriptor : option_table)
+        {
+            if (descriptor.kind == option_kind::option && has_id(descriptor))
+            {
+                descriptor.list_delimiter = delimiter;
+                return true;
+            }
+        }
 
-        if (end_of_options_it != argv.end())
-            *end_of_options_it = ""; // remove -- before parsing positional arguments
+        return false;
+    }
 
-        for (auto && f : positional_option_calls)
-            f();
+    /*!\brief Uses the perfect hash of the given schema to look up long identifiers.
+     * \param[in] option_schema The schema of the parser; the underlying sharg::option_schema must outlive this object.
+     */
+    void set_option_schema(option_schema_view const option_schema)
+    {
+        schema = option_schema;
+    }
 
-        check_for_left_over_args();
+    /*!\brief Initiates the actual command line parsing.
+     *
+     * \details
+     *
+     * Parsing stops at the first error, which is stored and can be retrieved via format_parse::result().
+     * The file validators share a sharg::detail::file_status_cache that lives until the end of this call.
+     * Files that validators created are removed again if parsing fails. A parse context, which does not store the
+     * values, does not create any files (see sharg::detail::created_files).
+     */
+    void parse(parser_meta_data const & /*meta*/)
+    {
+        file_status_cache metadata_cache{};
+        file_status_cache::scope const use_metadata_cache{&metadata_cache};
+        created_files new_files{!store_values};
+        created_files::scope const use_new_files{&new_files};
+
+        parse_options_and_positional_options();
+
+        if (store_values && error.success())
+            new_files.commit();
+    }
+
+    //!\brief Returns the result of the last call to format_parse::parse.
+    parse_result const & result() const noexcept
+    {
+        return error;
     }
 
     // functions are not needed for command line parsing but are part of the format interface.
@@ -183,27 +326,83 @@ public:
         if (is_empty_id(id))
             return end_it;
 
-        return (std::find_if(begin_it, end_it,
-            [&] (std::string const & current_arg)
-            {
-                std::string full_id = prepend_dash(id);
+        return std::find_if(begin_it, end_it, [&] (std::string_view const current_arg)
+        {
+            return is_option_id(current_arg, id);
+        });
+    }
 
-                if constexpr (std::same_as<id_type, char>) // short id
-                {
-                    // check if current_arg starts with "-o", i.e. it correctly identifies all short notations:
-                    // "-ovalue", "-o=value", and "-o value".
-                    return current_arg.substr(0, full_id.size()) == full_id;
-                }
-                else
-                {
-                    // only "--opt Value" or "--opt=Value" are valid
-                    return current_arg.substr(0, full_id.size()) == full_id && // prefix is the same
-                           (current_arg.size() == full_id.size() || current_arg[full_id.size()] == '='); // space or `=`
-                }
-            }));
+    /*!\brief Checks whether `arg` denotes the short/long identifier `id` (with or without a value attached).
+     * \tparam id_type The identifier type; must be either of type `char` or std::string.
+     * \param[in] arg The command line argument to check.
+     * \param[in] id  The identifier to check for (must not contain dashes).
+     * \returns `true` if `arg` is one of `-id`, `-idValue`, `-id=Value` (short id) or `--id`, `--id=Value` (long id).
+     */
+    template <typename id_type>
+    static bool is_option_id(std::string_view const arg, id_type const & id)
+    {
+        if constexpr (std::same_as<id_type, char>) // short id
+        {
+            // check if arg starts with "-o", i.e. it correctly identifies all short notations:
+            // "-ovalue", "-o=value", and "-o value".
+            return arg.size() >= 2 && arg[0] == '-' && arg[1] == id;
+        }
+        else
+        {
+            // only "--opt Value" or "--opt=Value" are valid
+            return arg.size() >= id.size() + 2 && arg.starts_with("--") && arg.substr(2, id.size()) == id && // prefix
+                   (arg.size() == id.size() + 2 || arg[id.size() + 2] == '='); // space or `=`
+        }
     }
 
 private:
+    //!\brief Parses the command line, see parse().
+    void parse_options_and_positional_options()
+    {
+        error = parse_result{};
+        end_of_options_it = std::find(argv.begin(), argv.end(), "--");
+        build_id_index();
+
+        // parse options first, because we need to rule out -keyValue pairs
+        // (e.g. -AnoSpaceAfterIdentifierA) before parsing flags
+        for (option_descriptor const & descriptor : descriptors())
+            if (descriptor.kind == option_kind::option && !descriptor.parse(*this, descriptor))
+                return;
+
+        for (option_descriptor const & descriptor : descriptors())
+        {
+            if (descriptor.kind == option_kind::flag)
+            {
+                bool is_set{};
+                get_flag(store_values ? *static_cast<bool *>(descriptor.value) : is_set,
+                         descriptor.short_id,
+                         descriptor.long_id);
+            }
+        }
+
+        if (!check_for_unknown_ids())
+            return;
+
+        if (end_of_options_it != argv.end())
+            consume_argument(end_of_options_it - argv.begin()); // remove -- before parsing positional arguments
+
+        for (option_descriptor const & descriptor : descriptors())
+            if (descriptor.kind == option_kind::positional_option && !descriptor.parse(*this, descriptor))
+                return;
+
+        check_for_left_over_args();
+    }
+
+    //!\brief Describes the kind of a single command line argument, see format_parse::build_id_index.
+    enum class argument_kind : uint8_t
+    {
+        value,              //!< A value or positional option, e.g. `foo`, `-` or the value in `-i foo`.
+        short_cluster,      //!< One or more short identifiers, possibly followed by a value, e.g. `-abc` or `-i=5`.
+        long_id,            //!< A long identifier, e.g. `--foo`.
+        long_id_with_value, //!< A long identifier followed by `=` and a value, e.g. `--foo=bar`.
+        end_of_options      //!< The end of options identifier `--`.
+    };
+
     //!\brief Describes the result of parsing the user input string given the respective option value type.
     enum class option_parse_result
     {
@@ -230,6 +429,18 @@ private:
         return {'-', short_id};
     }
 
+    //!\brief Returns the size of the short identifier prepended with a single dash, i.e. `2`.
+    static constexpr size_t dashed_id_size(char const)
+    {
+        return 2u;
+    }
+
+    //!\brief Returns the size of the long identifier prepended with a double dash.
+    static size_t dashed_id_size(std::string const & long_id)
+    {
+        return long_id.size() + 2u;
+    }
+
     /*!\brief Returns "-[short_id]/--[long_id]" if both are non-empty or just one of them if the other is empty.
     * \param[in] short_id The name of the short identifier.
     * \param[in] long_id  The name of the long identifier.
@@ -250,12 +461,16 @@ private:
      */
     bool flag_is_set(std::string const & long_id)
     {
-        auto it = std::find(argv.begin(), end_of_options_it, prepend_dash(long_id));
-
-        if (it != end_of_options_it)
-            *it = ""; // remove seen flag
+        for (size_t const pos : option_id_positions(long_id))
+        {
+            if (argv[pos].size() == long_id.size() + 2 && is_option_id(argv[pos], long_id))
+            {
+                consume_argument(pos); // remove seen flag
+                return true;
+            }
+        }
 
-        return(it != end_of_options_it);
+        return false;
     }
 
     /*!\brief Returns true and removes the short identifier if it is in format_parse::argv.
@@ -264,18 +479,26 @@ private:
     bool flag_is_set(char const short_id)
     {
         // short flags need special attention, since they could be grouped (-rGv <=> -r -G -v)
-        for (std::string & arg : argv)
+        for (size_t const arg_pos : id_positions(flag_cluster_positions, short_id))
         {
-            if (arg[0] == '-' && arg.size() > 1 && arg[1] != '-') // is option && not dash && no long option
+            std::string_view const arg = argv[arg_pos];
+
+            if (arg.size() > 1 && arg[0] == '-' && arg[1] != '-') // is option && not dash && no long option
             {
                 auto pos = arg.find(short_id);
 
                 if (pos != std::string::npos)
                 {
-                    arg.erase(pos, 1); // remove seen bool
-
-                    if (arg == "-") // if flag is empty now
-                        arg = "";
+                    if (arg.size() == 2) // if flag is empty after removing the seen bool
+                    {
+                        consume_argument(arg_pos);
+                    }
+                    else // the argument cannot be changed in place, so a copy is created once
+                    {
+                        std::string & cluster = materialised_arguments.try_emplace(arg_pos, arg).first->second;
+                        cluster.erase(pos, 1); // remove seen bool
+                        argv[arg_pos] = cluster;
+                    }
 
                     return true;
                 }
@@ -284,24 +507,241 @@ private:
         return false;
     }
 
-    /*!\brief Tries to parse an input string into a value using the stream `operator>>`.
-     * \tparam option_t Must model sharg::istreamable.
+    /*!\brief Marks the argument at `position` as consumed.
+     * \param[in] position The position in format_parse::argv.
+     *
+     * \details
+     *
+     * The argument is also replaced by an empty string, such that looking up an identifier in the index
+     * (which may hold positions of consumed arguments) does not match it again.
+     */
+    void consume_argument(size_t const position)
+    {
+        argv[position] = "";
+        consumed_arguments[position] = true;
+    }
+
+    /*!\brief Returns the position of the first argument at or after the cursor that is not consumed, or argv.size().
+     *
+     * \details
+     *
+     * Positional options are bound after all options and flags were consumed, i.e. no argument before the cursor is
+     * released again. Hence, binding all positional options and detecting left over arguments visits every argument
+     * at most once.
+     */
+    size_t next_unconsumed_argument() noexcept
+    {
+        while (positional_cursor < argv.size() && consumed_arguments[positional_cursor])
+            ++positional_cursor;
+
+        return positional_cursor;
+    }
+
+    /*!\brief Classifies a single command line argument.
+     * \param[in] arg The argument to classify.
+     * \returns The sharg::detail::format_parse::argument_kind of `arg`.
+     */
+    static argument_kind classify_argument(std::string_view const arg)
+    {
+        if (arg == "--")
+            return argument_kind::end_of_options;
+        else if (arg.starts_with("--"))
+            return (arg.find('=') == std::string_view::npos) ? argument_kind::long_id : argument_kind::long_id_with_value;
+        else if (arg.size() > 1 && arg[0] == '-')
+            return argument_kind::short_cluster;
+        else
+            return argument_kind::value;
+    }
+
+    /*!\brief Tokenizes format_parse::argv once and stores the positions of all identifiers.
+     *
+     * \details
+     *
+     * Every argument is classified (see format_parse::argument_kind). For short clusters (e.g. `-abc` or `-i5`),
+     * the position is stored for the first character in format_parse::short_id_positions (only before `--`) and for
+     * every character in format_parse::flag_cluster_positions. For long identifiers before `--`, the position is
+     * stored for the identifier without dashes and value (e.g. `foo` for `--foo=bar`) in
+     * format_parse::long_id_positions. If a schema is set, the long identifiers are instead mapped to their index
+     * in the schema and the positions are stored consecutively per index (see build_schema_long_id_index).
+     *
+     * Since arguments are only ever removed from argv while parsing, the index always holds a superset of the
+     * positions where an identifier can be found. Each position is therefore checked again when it is looked up.
+     */
+    void build_id_index()
+    {
+        size_t const end_of_options = end_of_options_it - argv.begin();
+
+        argument_kinds.clear();
+        argument_kinds.reserve(argv.size());
+        consumed_arguments.assign(argv.size(), false);
+        positional_cursor = 0;
+        short_id_positions.clear();
+        flag_cluster_positions.clear();
+        long_id_positions.clear();
+        materialised_arguments.clear();
+
+        std::vector<std::pair<size_t, size_t>> schema_long_ids{}; // (index in schema, position in argv)
+
+        for (size_t i = 0; i < argv.size(); ++i)
+        {
+            std::string_view const arg = argv[i];
+            argument_kind const kind = classify_argument(arg);
+            argument_kinds.push_back(kind);
+            consumed_arguments[i] = arg.empty(); // empty arguments have always been ignored
+
+            if (kind == argument_kind::short_cluster)
+            {
+                if (i < end_of_options)
+                    short_id_positions[arg[1]].push_back(i);
+
+                for (char const c : arg.substr(1)) // flags are found anywhere (even after `--`)
+                {
+                    std::vector<size_t> & positions = flag_cluster_positions[c];
+                    if (positions.empty() || positions.back() != i)
+                        positions.push_back(i);
+                }
+            }
+            else if ((kind == argument_kind::long_id || kind == argument_kind::long_id_with_value) &&
+                     i < end_of_options)
+            {
+                // npos - 2 is still larger than the size of arg
+                std::string_view const long_id = arg.substr(2, arg.find('=') - 2);
+
+                if (schema.has_value())
+                    schema_long_ids.emplace_back(schema->find_long_id(long_id), i);
+                else
+                    long_id_positions[long_id].push_back(i);
+            }
+        }
+
+        if (schema.has_value())
+            build_schema_long_id_index(schema_long_ids);
+    }
+
+    /*!\brief Stores the positions of the long identifiers of the schema grouped by their index in the schema.
+     * \param[in] schema_long_ids Pairs of (index in schema, position in argv), ordered by position.
+     *
+     * \details
+     *
+     * The positions of the identifier with index `i` are stored in
+     * `schema_long_id_positions[schema_long_id_offsets[i], schema_long_id_offsets[i + 1])`.
+     * Identifiers that are not part of the schema are skipped; they are reported by check_for_unknown_ids.
+     */
+    void build_schema_long_id_index(std::vector<std::pair<size_t, size_t>> const & schema_long_ids)
+    {
+        size_t const schema_size = schema->identifiers().size();
+        schema_long_id_offsets.assign(schema_size + 1, 0);
+
+        for (auto const & [index, pos] : schema_long_ids)
+            if (index != option_schema_view::npos)
+                ++schema_long_id_offsets[index + 1];
+
+        for (size_t i = 0; i < schema_size; ++i)
+            schema_long_id_offsets[i + 1] += schema_long_id_offsets[i];
+
+        schema_long_id_positions.resize(schema_long_id_offsets.back());
+
+        // fill each range from its start; afterwards offsets[i] holds the end of range i, i.e. the start of i + 1
+        for (auto const & [index, pos] : schema_long_ids)
+            if (index != option_schema_view::npos)
+                schema_long_id_positions[schema_long_id_offsets[index]++] = pos;
+
+        for (size_t i = schema_size; i > 0; --i)
+            schema_long_id_offsets[i] = schema_long_id_offsets[i - 1];
+        schema_long_id_offsets[0] = 0;
+    }
+
+    /*!\brief Returns the positions stored for an identifier in one of the indices built by build_id_index.
+     * \param[in] index The index to search in.
+     * \param[in] id    The identifier to look up.
+     * \returns The (possibly empty) list of positions in format_parse::argv in increasing order.
+     */
+    template <typename index_type, typename id_type>
+    static std::span<size_t const> id_positions(index_type const & index, id_type const & id)
+    {
+        if (is_empty_id(id))
+            return {};
+
+        auto it = index.find(id);
+        return (it == index.end()) ? std::span<size_t const>{} : std::span<size_t const>{it->second};
+    }
+
+    /*!\brief Returns the positions of the option identifier `id` in format_parse::argv (before `--`).
+     * \param[in] id The short or long identifier to look up.
+     */
+    template <typename id_type>
+    std::span<size_t const> option_id_positions(id_type const & id) const
+    {
+        if constexpr (std::same_as<id_type, char>)
+        {
+            return id_positions(short_id_positions, id);
+        }
+        else if (schema.has_value())
+        {
+            size_t const index = schema->find_long_id(id);
+
+            if (index == option_schema_view::npos)
+                return {};
+
+            return std::span<size_t const>{schema_long_id_positions}.subspan(schema_long_id_offsets[index],
+                                                                             schema_long_id_offsets[index + 1] -
+                                                                             schema_long_id_offsets[index]);
+        }
+        else
+        {
+            return id_positions(long_id_positions, id);
+        }
+    }
+
+    /*!\brief Finds the next position in [`begin_it`, `end_it`) that still holds the option identifier `id`.
+     * \param[in] begin_it The iterator to the first candidate position.
+     * \param[in] end_it   The iterator one past the last candidate position.
+     * \param[in] id       The short or long identifier to search for.
+     * \returns An iterator to the first matching position or `end_it`.
+     */
+    template <typename id_type>
+    std::span<size_t const>::iterator find_option_position(std::span<size_t const>::iterator begin_it,
+                                                           std::span<size_t const>::iterator end_it,
+                                                           id_type const & id) const
+    {
+        return std::find_if(begin_it, end_it, [&] (size_t const pos) { return is_option_id(argv[pos], id); });
+    }
+
+    /*!\brief Tries to parse an input string into a value using sharg::from_chars or the stream `operator>>`.
+     * \tparam option_t Must model sharg::from_chars_parsable or sharg::istreamable.
      * \param[out] value Stores the parsed value.
      * \param[in] in The input argument to be parsed.
-     * \returns sharg::option_parse_result::error if `in` could not be parsed via the stream
-     *          operator and otherwise sharg::option_parse_result::success.
+     * \returns sharg::option_parse_result::error if `in` could not be parsed (completely),
+     *          sharg::option_parse_result::overflow_error if sharg::from_chars reports `std::errc::result_out_of_range`
+     *          and otherwise sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * sharg::from_chars is preferred; it parses the argument in place, without constructing a stream.
      */
     template <typename option_t>
     //!\cond
-        requires istreamable<option_t>
+        requires istreamable<option_t> || from_chars_parsable<option_t>
     //!\endcond
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        std::istringstream stream{in};
-        stream >> value;
+        if constexpr (from_chars_parsable<option_t>)
+        {
+            std::from_chars_result const res = sharg::from_chars(in, value);
 
-        if (stream.fail() || !stream.eof())
-            return option_parse_result::error;
+            if (res.ec == std::errc::result_out_of_range)
+                return option_parse_result::overflow_error;
+            else if (res.ec != std::errc{} || res.ptr != in.data() + in.size())
+                return option_parse_result::error;
+        }
+        else
+        {
+            std::istringstream stream{std::string{in}};
+            stream >> value;
+
+            if (stream.fail() || !stream.eof())
+                return option_parse_result::error;
+        }
 
         return option_parse_result::success;
     }
@@ -310,56 +750,83 @@ private:
      * \tparam option_t Must model sharg::named_enumeration.
      * \param[out] value Stores the parsed value.
      * \param[in] in The input argument to be parsed.
-     * \throws sharg::user_input_error if `in` is not a key in sharg::enumeration_names<option_t>.
-     * \returns sharg::option_parse_result::success.
+     * \returns sharg::option_parse_result::error if `in` is not a key in sharg::enumeration_names<option_t> and
+     *          otherwise sharg::option_parse_result::success.
      */
     template <named_enumeration option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        auto map = sharg::enumeration_names<option_t>;
+        // a reference: the names are looked up in place, without copying the map for every value
+        auto const & names = sharg::enumeration_names<option_t>;
 
-        if (auto it = map.find(in); it == map.end())
+        auto const it = [&] ()
         {
-            std::string keys = [&map] ()
-            {
-                std::vector<std::pair<std::string_view, option_t>> key_value_pairs(map.begin(), map.end());
-
-                std::sort(key_value_pairs.begin(), key_value_pairs.end(), [] (auto pair1, auto pair2)
-                {
-                    if constexpr (std::totally_ordered<option_t>)
-                    {
-                        if (pair1.second != pair2.second)
-                            return pair1.second < pair2.second;
-                    }
+            if constexpr (requires { names.find(in); })
+                return names.find(in);
+            else
+                return std::ranges::find(names, in, [] (auto const & entry) { return std::string_view{entry.first}; });
+        }();
+
+        if (it == std::ranges::end(names))
+            return option_parse_result::error; // the message lists the valid keys, see check_input_result
+        else
+            value = it->second;
 
-                    return pair1.first < pair2.first;
-                }); // needed for deterministic output when using unordered maps
+        return option_parse_result::success;
+    }
 
-                std::string result{'['};
-                for (auto const & [key, value] : key_value_pairs)
-                    result += std::string{key.data()} + ", ";
-                result.replace(result.size() - 2, 2, "]"); // replace last ", " by "]"
-                return result;
-            }();
+    /*!\brief Returns the keys of sharg::enumeration_names<option_t> as a list, e.g. "[bar, foo]".
+     * \tparam option_t Must model sharg::named_enumeration.
+     */
+    template <named_enumeration option_t>
+    static std::string enumeration_keys()
+    {
+        auto const & names = sharg::enumeration_names<option_t>;
+        std::vector<std::pair<std::string_view, option_t>> key_value_pairs(std::ranges::begin(names),
+                                                                          std::ranges::end(names));
 
-            throw user_input_error{"You have chosen an invalid input value: " + in + ". Please use one of: " + keys};
-        }
-        else
+        std::sort(key_value_pairs.begin(), key_value_pairs.end(), [] (auto pair1, auto pair2)
         {
-            value = it->second;
-        }
+            if constexpr (std::totally_ordered<option_t>)
+            {
+                if (pair1.second != pair2.second)
+                    return pair1.second < pair2.second;
+            }
 
-        return option_parse_result::success;
+            return pair1.first < pair2.first;
+        }); // needed for deterministic output when using unordered maps
+
+        std::string result{'['};
+        for (auto const & [key, value] : key_value_pairs)
+            result += std::string{key} + ", ";
+        result.replace(result.size() - 2, 2, "]"); // replace last ", " by "]"
+        return result;
     }
 
     //!\cond
-    option_parse_result parse_option_value(std::string & value, std::string const & in)
+    option_parse_result parse_option_value(std::string & value, std::string_view const in)
     {
         value = in;
         return option_parse_result::success;
     }
     //!\endcond
 
+    /*!\brief Sets a path to the input string.
+     * \param[out] value Stores the path.
+     * \param[in] in The input argument.
+     * \returns sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * The argument is taken as it is, like for std::string. In contrast to the stream `operator>>` of
+     * std::filesystem::path, quotes are not removed and white space is part of the path.
+     */
+    option_parse_result parse_option_value(std::filesystem::path & value, std::string_view const in)
+    {
+        value = in;
+        return option_parse_result::success;
+    }
+
     /*!\brief Parses the given option value and appends it to the target container.
      * \tparam container_option_t Must model sharg::detail::is_container_option and
      *                            its value_type must be parseable via parse_option_value
@@ -375,19 +842,19 @@ private:
     //!\cond
         requires requires (format_parse_t fp,
                            typename container_option_t::value_type & container_value,
-                           std::string const & in)
+                           std::string_view const in)
         {
             {fp.parse_option_value(container_value, in)} -> std::same_as<option_parse_result>;
         }
     //!\endcond
-    option_parse_result parse_option_value(container_option_t & value, std::string const & in)
+    option_parse_result parse_option_value(container_option_t & value, std::string_view const in)
     {
         typename container_option_t::value_type tmp{};
 
         auto res = parse_option_value(tmp, in);
 
         if (res == option_parse_result::success)
-            value.push_back(tmp);
+            value.push_back(std::move(tmp));
 
         return res;
     }
@@ -402,19 +869,26 @@ private:
      *
      * \details
      *
-     * This function delegates to std::from_chars.
+     * This function delegates to std::from_chars. Integers are parsed by sharg::detail::from_chars_integer, which
+     * converts eight digits at a time but gives the same result.
      */
     template <typename option_t>
     //!\cond
         requires std::is_arithmetic_v<option_t> && istreamable<option_t>
     //!\endcond
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        auto res = std::from_chars(&in[0], &in[in.size()], value);
+        auto res = [&] ()
+        {
+            if constexpr (std::integral<option_t>)
+                return from_chars_integer(in.data(), in.data() + in.size(), value);
+            else
+                return std::from_chars(in.data(), in.data() + in.size(), value);
+        }();
 
         if (res.ec == std::errc::result_out_of_range)
             return option_parse_result::overflow_error;
-        else if (res.ec == std::errc::invalid_argument || res.ptr != &in[in.size()])
+        else if (res.ec == std::errc::invalid_argument || res.ptr != in.data() + in.size())
             return option_parse_result::error;
 
         return option_parse_result::success;
@@ -430,7 +904,7 @@ private:
      * This function accepts the strings "0" or "false" which sets sets `value` to `false` or "1" or "true" which
      * sets `value` to `true`.
      */
-    option_parse_result parse_option_value(bool & value, std::string const & in)
+    option_parse_result parse_option_value(bool & value, std::string_view const in)
     {
         if (in == "0")
             value = false;
@@ -446,37 +920,219 @@ private:
         return option_parse_result::success;
     }
 
-    /*!\brief Tries to parse an input string into boolean value.
+    //!\brief Reserves space for `count` more values if the container supports it.
+    template <detail::is_container_option container_option_t>
+    static void reserve(container_option_t & value, std::integral auto const count)
+    {
+        if constexpr (requires { value.reserve(value.size()); })
+            value.reserve(value.size() + static_cast<size_t>(count));
+    }
+
+    //!\brief The element check of options whose validator is always called, see format_parse::range_check.
+    struct no_element_check
+    {
+        //!\brief Does nothing.
+        constexpr void operator()(auto const &) const noexcept
+        {}
+
+        //!\brief The validator is always called.
+        static constexpr bool requires_validation() noexcept
+        {
+            return true;
+        }
+    };
+
+    /*!\brief Checks the values of an arithmetic container option against its sharg::arithmetic_range_validator while
+     *        they are parsed.
+     * \tparam validator_type The type of the sharg::arithmetic_range_validator.
+     *
+     * \details
+     *
+     * Each value is compared to the bounds right after it was converted, instead of walking the container again after
+     * parsing. The validator is only called if a value is out of range, in order to report the same error.
+     */
+    template <typename validator_type>
+    struct range_check
+    {
+        //!\brief The validator of the option.
+        validator_type const & validator;
+        //!\brief Whether all values seen so far are in range.
+        bool all_in_range{true};
+
+        //!\brief Checks the value that was appended last.
+        void operator()(auto const & container) noexcept
+        {
+            all_in_range &= validator.is_in_range(container.back());
+        }
+
+        //!\brief Whether the validator must be called to report a value that is out of range.
+        bool requires_validation() const noexcept
+        {
+            return !all_in_range;
+        }
+    };
+
+    //!\brief Returns a format_parse::range_check for arithmetic container options with a range validator.
+    template <typename option_type, typename validator_type>
+    static auto make_element_check(validator_type const & validator) noexcept
+    {
+        if constexpr (detail::is_container_option<option_type> &&
+                      is_arithmetic_range_validator<std::remove_cvref_t<validator_type>>)
+        {
+            if constexpr (std::is_arithmetic_v<std::ranges::range_value_t<option_type>>)
+                return range_check<std::remove_cvref_t<validator_type>>{validator};
+            else
+                return no_element_check{};
+        }
+        else
+        {
+            return no_element_check{};
+        }
+    }
+
+    /*!\brief Parses the values of a list option that are given in a single argument, e.g. `1,2,3`.
+     * \param[out] value         The container that the values are appended to.
+     * \param[in]  input_value   The argument that holds the values.
+     * \param[in]  delimiter     The character that separates the values.
+     * \param[in]  option_name   The name of the option, used in error messages.
+     * \param[in]  position      The position of `input_value` in format_parse::argv.
+     * \param[in]  element_check Called with `value` after each successfully parsed value.
+     * \returns `false` if a value could not be parsed; the error is recorded.
+     *
+     * \details
+     *
+     * The argument is scanned once: each delimiter is found with std::memchr, which the standard library implements
+     * with vector instructions, and the value in front of it is parsed in place. Space for all values is reserved
+     * before. An empty value (e.g. in `1,,2`) is parsed like any other value.
+     */
+    template <detail::is_container_option option_type, typename element_check_type>
+    bool parse_delimited_values(option_type & value,
+                                std::string_view const input_value,
+                                char const delimiter,
+                                std::string const & option_name,
+                                size_t const position,
+                                element_check_type & element_check)
+    {
+        char const * first = input_value.data();
+        char const * const last = first + input_value.size();
+
+        reserve(value, std::count(first, last, delimiter) + 1);
+
+        while (true)
+        {
+            char const * const next = static_cast<char const *>(std::memchr(first, delimiter, last - first));
+            std::string_view const element{first, static_cast<size_t>(((next == nullptr) ? last : next) - first)};
+            auto res = parse_option_value(value, element);
+
+            if (res != option_parse_result::success)
+                return check_input_result<option_type>(res, option_name, element, position);
+
+            element_check(value);
+
+            if (next == nullptr)
+                return true;
+
+            first = next + 1;
+        }
+    }
+
+    /*!\brief Checks the result of parsing an input string and records an error if it was not successful.
      * \param[in] res A result value of parsing an input string to the respective option value type.
      * \param[in] option_name The name of the option whose input was parsed.
      * \param[in] input_value The original user input in question.
+     * \param[in] position The position of `input_value` in format_parse::argv.
      *
-     * \throws sharg::user_input_error if `res` was not sharg::option_parse_result::success.
+     * \returns `true` if `res` is sharg::option_parse_result::success. Otherwise, a
+     *          sharg::parse_error_kind::user_input_error is recorded and `false` is returned.
      */
     template <typename option_type>
-    void throw_on_input_error(option_parse_result const res,
-                              std::string const & option_name,
-                              std::string const & input_value)
+    bool check_input_result(option_parse_result const res,
+                            std::string const & option_name,
+                            std::string_view const input_value,
+                            size_t const position)
     {
-        std::string msg{"Value parse failed for " + option_name + ": "};
+        if (res == option_parse_result::success)
+            return true;
+
+        // the type of a single value, i.e. the value type of a container option
+        using value_type = typename decltype([] ()
+        {
+            if constexpr (detail::is_container_option<option_type>)
+                return std::type_identity<std::ranges::range_value_t<option_type>>{};
+            else
+                return std::type_identity<option_type>{};
+        }())::type;
 
-        if (res == option_parse_result::error)
+        if constexpr (named_enumeration<value_type>)
         {
-            throw user_input_error{msg + "Argument " + input_value + " could not be parsed as type " +
-                                   get_type_name_as_string(option_type{}) + "."};
+            return fail(parse_error_kind::user_input_error, position, option_name,
+                        [input_value] (parse_result const &)
+            {
+                return "You have chosen an invalid input value: " + std::string{input_value} +
+                       ". Please use one of: " + enumeration_keys<value_type>();
+            });
         }
 
         if constexpr (std::is_arithmetic_v<option_type>)
         {
             if (res == option_parse_result::overflow_error)
             {
-                throw user_input_error{msg + "Numeric argument " + input_value + " is not in the valid range [" +
-                                       std::to_string(std::numeric_limits<option_type>::min()) + "," +
-                                       std::to_string(std::numeric_limits<option_type>::max()) + "]."};
+                return fail(parse_error_kind::user_input_error, position, option_name,
+                            [input_value] (parse_result const & result)
+                {
+                    return "Value parse failed for " + std::string{result.option_id()} + ": Numeric argument " +
+                           std::string{input_value} + " is not in the valid range [" +
+                           std::to_string(std::numeric_limits<option_type>::min()) + "," +
+                           std::to_string(std::numeric_limits<option_type>::max()) + "].";
+                });
             }
         }
 
-        assert(res == option_parse_result::success); // if nothing was thrown, the result must have been a success
+        return fail(parse_error_kind::user_input_error, position, option_name,
+                    [input_value] (parse_result const & result)
+        {
+            return "Value parse failed for " + std::string{result.option_id()} + ": Argument " +
+                   std::string{input_value} + " could not be parsed as type " +
+                   get_type_name_as_string(option_type{}) + ".";
+        });
+    }
+
+    /*!\brief Records an error of the given kind and returns `false`.
+     * \param[in] kind      The kind of the error.
+     * \param[in] position  The position of the offending argument in format_parse::argv or parse_result::npos.
+     * \param[in] option_id The identifier of the offending option.
+     * \param[in] formatter Formats the message on demand.
+     *
+     * \details
+     *
+     * The engine does not throw on invalid user input. Instead, the first error is recorded and every step of
+     * format_parse::parse returns `false`, such that parsing stops immediately. sharg::parser::parse converts the
+     * recorded error into the respective exception, sharg::parser::try_parse returns it.
+     */
+    bool fail(parse_error_kind const kind,
+              size_t const position,
+              std::string option_id,
+              parse_result::formatter_type formatter)
+    {
+        error = parse_result{kind, argument_index(position), std::move(option_id), std::move(formatter)};
+        return false;
+    }
+
+    /*!\brief Maps a position in format_parse::argv to the index in the original `argv`.
+     * \param[in] position The position in format_parse::argv or parse_result::npos.
+     */
+    size_t argument_index(size_t const position) const
+    {
+        if (position == parse_result::npos)
+            return position;
+
+        size_t index = position + 1; // argv[0] is the program name
+
+        for (size_t const removed : removed_argument_indices) // sorted
+            if (removed <= index)
+                ++index;
+
+        return index;
     }
 
     /*!\brief Handles value retrieval for options based on different key-value pairs.
@@ -484,67 +1140,87 @@ private:
      * \param[out] value     Stores the value found in argv, parsed by parse_option_value.
      * \param[in]  option_it The iterator where the option identifier was found.
      * \param[in]  id        The option identifier supplied on the command line.
-     *
-     * \throws sharg::too_few_arguments if the option was not followed by a value.
-     * \throws sharg::user_input_error if the given option value was invalid.
+     * \param[in]  list_delimiter Separates several values of a list option in one argument (`'\0'` if not set).
+     * \param[in]  element_check Called with `value` after each successfully parsed value, see format_parse::range_check.
      *
      * \details
      *
      * The value at option_it is inspected whether it is an '-key value', '-key=value'
      * or '-keyValue' pair and the input is extracted accordingly. The input
-     * will then be tried to be parsed into the `value` parameter.
+     * will then be tried to be parsed into the `value` parameter. If a list delimiter is set, the input is split
+     * into several values, see format_parse::parse_delimited_values.
      *
-     * Returns true on success and false otherwise.
+     * Returns true on success. If the option was not followed by a value (sharg::parse_error_kind::too_few_arguments)
+     * or the given option value was invalid (sharg::parse_error_kind::user_input_error), the error is recorded and
+     * false is returned.
      */
-    template <typename option_type, typename id_type>
+    template <typename option_type, typename id_type, typename element_check_type>
     bool identify_and_retrieve_option_value(option_type & value,
-                                            std::vector<std::string>::iterator & option_it,
-                                            id_type const & id)
+                                            std::vector<std::string_view>::iterator & option_it,
+                                            id_type const & id,
+                                            char const list_delimiter,
+                                            element_check_type & element_check)
     {
-        if (option_it != end_of_options_it)
+        assert(option_it != end_of_options_it);
+
+        auto missing_value = [] (parse_result const & result)
         {
-            std::string input_value;
-            size_t id_size = (prepend_dash(id)).size();
+            return "Missing value for option " + std::string{result.option_id()};
+        };
 
-            if ((*option_it).size() > id_size) // identifier includes value (-keyValue or -key=value)
-            {
-                if ((*option_it)[id_size] == '=') // -key=value
-                {
-                    if ((*option_it).size() == id_size + 1) // malformed because no value follows '-i='
-                        throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                    input_value = (*option_it).substr(id_size + 1);
-                }
-                else // -kevValue
-                {
-                    input_value = (*option_it).substr(id_size);
-                }
+        std::string_view input_value;
+        size_t id_size{dashed_id_size(id)};
 
-                *option_it = ""; // remove used identifier-value pair
+        if ((*option_it).size() > id_size) // identifier includes value (-keyValue or -key=value)
+        {
+            if ((*option_it)[id_size] == '=') // -key=value
+            {
+                if ((*option_it).size() == id_size + 1) // malformed because no value follows '-i='
+                    return fail(parse_error_kind::too_few_arguments, option_it - argv.begin(), prepend_dash(id),
+                                missing_value);
+                input_value = (*option_it).substr(id_size + 1);
             }
-            else // -key value
+            else // -kevValue
             {
-                *option_it = ""; // remove used identifier
-                ++option_it;
-                if (option_it == end_of_options_it) // should not happen
-                    throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                input_value = *option_it;
-                *option_it = ""; // remove value
+                input_value = (*option_it).substr(id_size);
             }
 
-            auto res = parse_option_value(value, input_value);
-            throw_on_input_error<option_type>(res, prepend_dash(id), input_value);
+            consume_argument(option_it - argv.begin()); // remove used identifier-value pair
+        }
+        else // -key value
+        {
+            consume_argument(option_it - argv.begin()); // remove used identifier
+            ++option_it;
+            if (option_it == end_of_options_it) // should not happen
+                return fail(parse_error_kind::too_few_arguments, option_it - argv.begin() - 1, prepend_dash(id),
+                            missing_value);
+            input_value = *option_it;
+            consume_argument(option_it - argv.begin()); // remove value
+        }
 
-            return true;
+        last_value_position = option_it - argv.begin();
+
+        if constexpr (detail::is_container_option<option_type>)
+        {
+            if (list_delimiter != '\0')
+                return parse_delimited_values(value, input_value, list_delimiter, prepend_dash(id),
+                                              last_value_position, element_check);
         }
-        return false;
+
+        auto res = parse_option_value(value, input_value);
+
+        if (res == option_parse_result::success)
+            element_check(value);
+
+        return check_input_result<option_type>(res, prepend_dash(id), input_value, last_value_position);
     }
 
     /*!\brief Handles value retrieval (non container type) options.
      *
      * \param[out] value Stores the value found in argv, parsed by parse_option_value.
      * \param[in] id The option identifier supplied on the command line.
-     *
-     * \throws sharg::option_declared_multiple_times
+     * \param[out] found Whether the option identifier was found.
+     * \param[in] element_check Passed to identify_and_retrieve_option_value.
      *
      * \details
      *
@@ -552,72 +1228,101 @@ private:
      * the following position in argv is tried to be parsed given the respective option value type
      * and the identifier and value argument are removed from argv.
      *
-     * Returns true on success and false otherwise. This is needed to catch
-     * the user error of supplying multiple arguments for the same
+     * `found` is needed to catch the user error of supplying multiple arguments for the same
      * (non container!) option by specifying the short AND long identifier.
+     *
+     * Returns false if an error was recorded, e.g. sharg::parse_error_kind::option_declared_multiple_times.
      */
-    template <typename option_type, typename id_type>
-    bool get_option_by_id(option_type & value, id_type const & id)
+    template <typename option_type, typename id_type, typename element_check_type>
+    bool get_option_by_id(option_type & value, id_type const & id, bool & found, element_check_type & element_check)
     {
-        auto it = find_option_id(argv.begin(), end_of_options_it, id);
+        std::span<size_t const> const positions = option_id_positions(id);
+        auto pos_it = find_option_position(positions.begin(), positions.end(), id);
+        found = (pos_it != positions.end());
 
-        if (it != end_of_options_it)
-            identify_and_retrieve_option_value(value, it, id);
+        if (found)
+        {
+            auto it = argv.begin() + *pos_it;
+            if (!identify_and_retrieve_option_value(value, it, id, '\0', element_check))
+                return false;
+            ++pos_it;
+        }
 
-        if (find_option_id(it, end_of_options_it, id) != end_of_options_it) // should not be found again
-           throw option_declared_multiple_times("Option " + prepend_dash(id) +
-                                                " is no list/container but declared multiple times.");
+        if (pos_it = find_option_position(pos_it, positions.end(), id); pos_it != positions.end()) // not again
+        {
+            return fail(parse_error_kind::option_declared_multiple_times, *pos_it, prepend_dash(id),
+                        [] (parse_result const & result)
+            {
+                return "Option " + std::string{result.option_id()} +
+                       " is no list/container but declared multiple times.";
+            });
+        }
 
-       return (it != end_of_options_it); // first search was successful or not
+        return true;
     }
 
     /*!\brief Handles value retrieval (container type) options.
      *
      * \param[out] value Stores all values found in argv, parsed by parse_option_value.
      * \param[in]  id    The option identifier supplied on the command line.
+     * \param[out] found Whether the option identifier was found at least once.
+     * \param[in]  list_delimiter Passed to identify_and_retrieve_option_value.
+     * \param[in]  element_check Passed to identify_and_retrieve_option_value.
      *
      * \details
      *
      * Since option_type is a container, the option is a list and can be parsed
-     * multiple times.
+     * multiple times, each occurrence may hold several values if a list delimiter is set.
+     * Space for all occurrences is reserved up front.
      *
+     * Returns false if an error was recorded.
      */
-    template <detail::is_container_option option_type, typename id_type>
-    bool get_option_by_id(option_type & value, id_type const & id)
+    template <detail::is_container_option option_type, typename id_type, typename element_check_type>
+    bool get_option_by_id(option_type & value,
+                          id_type const & id,
+                          bool & found,
+                          char const list_delimiter,
+                          element_check_type & element_check)
     {
-        auto it = find_option_id(argv.begin(), end_of_options_it, id);
-        bool seen_at_least_once{it != end_of_options_it};
+        std::span<size_t const> const positions = option_id_positions(id);
+        auto pos_it = find_option_position(positions.begin(), positions.end(), id);
+        found = (pos_it != positions.end());
 
-        if (seen_at_least_once)
+        if (found)
+        {
             value.clear();
+            reserve(value, positions.end() - pos_it); // an upper bound of the number of values
+        }
 
-        while (it != end_of_options_it)
+        while (pos_it != positions.end())
         {
-            identify_and_retrieve_option_value(value, it, id);
-            it = find_option_id(it, end_of_options_it, id);
+            auto it = argv.begin() + *pos_it;
+            if (!identify_and_retrieve_option_value(value, it, id, list_delimiter, element_check))
+                return false;
+            pos_it = find_option_position(++pos_it, positions.end(), id);
         }
 
-        return seen_at_least_once;
+        return true;
     }
 
     /*!\brief Checks format_parse::argv for unknown options/flags.
      *
-     * \throws sharg::unknown_option
+     * \returns `false` if an unknown option was found (sharg::parse_error_kind::unknown_option).
      *
      * \details
      *
      * This function is used by format_parse::parse() AFTER all flags and options
      * specified by the developer were parsed and therefore removed from argv.
      * Thus, all remaining flags/options are unknown.
-     *
-     * In addition this function removes "--" (if specified) from argv to
-     * clean argv for positional option retrieval.
      */
-    void check_for_unknown_ids()
+    bool check_for_unknown_ids()
     {
         for (auto it = argv.begin(); it != end_of_options_it; ++it)
         {
-            std::string arg{*it};
+            if (argument_kinds[it - argv.begin()] == argument_kind::value) // cannot be an identifier
+                continue;
+
+            std::string_view const arg{*it};
             if (!arg.empty() && arg[0] == '-') // may be an identifier
             {
                 if (arg == "-")
@@ -626,37 +1331,57 @@ private:
                 }
                 else if (arg[1] != '-' && arg.size() > 2) // one dash, but more than one character (-> multiple flags)
                 {
-                    throw unknown_option("Unknown flags " + expand_multiple_flags(arg) +
-                                         ". In case this is meant to be a non-option/argument/parameter, " +
-                                         "please specify the start of arguments with '--'. " +
-                                         "See -h/--help for program information.");
+                    return fail(parse_error_kind::unknown_option, it - argv.begin(), {},
+                                [arg] (parse_result const &)
+                    {
+                        return "Unknown flags " + expand_multiple_flags(std::string{arg}) +
+                               ". In case this is meant to be a non-option/argument/parameter, " +
+                               "please specify the start of arguments with '--'. " +
+                               "See -h/--help for program information.";
+                    });
                 }
                 else // unknown short or long option
                 {
-                    throw unknown_option("Unknown option " + arg +
-                                         ". In case this is meant to be a non-option/argument/parameter, " +
-                                         "please specify the start of non-options with '--'. " +
-                                         "See -h/--help for program information.");
+                    return fail(parse_error_kind::unknown_option, it - argv.begin(), {},
+                                [arg] (parse_result const &)
+                    {
+                        return "Unknown option " + std::string{arg} +
+                               ". In case this is meant to be a non-option/argument/parameter, " +
+                               "please specify the start of non-options with '--'. " +
+                               "See -h/--help for program information.";
+                    });
                 }
             }
         }
+
+        return true;
     }
 
-    /*!\brief Checks format_parse::argv for unknown options/flags.
+    /*!\brief Checks format_parse::argv for left over arguments.
      *
-     * \throws sharg::too_many_arguments
+     * \returns `false` if there are left over arguments (sharg::parse_error_kind::too_many_arguments).
      *
      * \details
      *
      * This function is used by format_parse::parse() AFTER all flags, options
      * and positional options specified by the developer were parsed and
      * therefore removed from argv.
-     * Thus, all remaining non-empty arguments are too much.
+     * Thus, all remaining arguments are too much. The positional options were bound via the same cursor
+     * (see format_parse::next_unconsumed_argument), so the arguments before it are not scanned again.
      */
-    void check_for_left_over_args()
+    bool check_for_left_over_args()
     {
-        if (std::find_if(argv.begin(), argv.end(), [](std::string const & s){return (s != "");}) != argv.end())
-            throw too_many_arguments("Too many arguments provided. Please see -h/--help for more information.");
+        size_t const position = next_unconsumed_argument();
+
+        if (position != argv.size())
+        {
+            return fail(parse_error_kind::too_many_arguments, position, {}, [] (parse_result const &)
+            {
+                return std::string{"Too many arguments provided. Please see -h/--help for more information."};
+            });
+        }
+
+        return true;
     }
 
     /*!\brief Handles command line option retrieval.
@@ -665,54 +1390,82 @@ private:
      * \param[in]  short_id  The short identifier for the option (e.g. 'i').
      * \param[in]  long_id   The long identifier for the option (e.g. "integer").
      * \param[in]  spec      Advanced option specification, see sharg::option_spec.
+     * \param[in]  list_delimiter Separates several values of a list option in one argument (`'\0'` if not set).
      * \param[in]  validator The validator applied to the value after parsing (callable).
      *
-     * \throws sharg::option_declared_multiple_times
-     * \throws sharg::validation_error
-     * \throws sharg::required_option_missing
+     * \returns `false` if an error was recorded.
      *
      * \details
      *
      * This function
-     * - checks if the option is required but not set,
+     * - checks if the option is required but not set (sharg::parse_error_kind::required_option_missing),
      * - retrieves any value found by the short or long identifier,
-     * - throws on (mis)use of both identifiers for non-container type values,
-     * - re-throws the validation exception with appended option information.
+     * - fails on (mis)use of both identifiers for non-container type values
+     *   (sharg::parse_error_kind::option_declared_multiple_times),
+     * - records the validation exception with appended option information (sharg::parse_error_kind::validation_error).
      */
     template <typename option_type, typename validator_type>
-    void get_option(option_type & value,
-                     char const short_id,
-                     std::string const & long_id,
-                     option_spec const spec,
-                     validator_type && validator)
+    bool get_option(option_type & value,
+                    char const short_id,
+                    std::string const & long_id,
+                    option_spec const spec,
+                    char const list_delimiter,
+                    validator_type && validator)
     {
-        bool short_id_is_set{get_option_by_id(value, short_id)};
-        bool long_id_is_set{get_option_by_id(value, long_id)};
+        bool short_id_is_set{false};
+        bool long_id_is_set{false};
+        auto element_check = make_element_check<option_type>(validator);
+
+        auto get_option_by = [&] (auto const & id, bool & found)
+        {
+            if constexpr (detail::is_container_option<option_type>)
+                return get_option_by_id(value, id, found, list_delimiter, element_check);
+            else
+                return get_option_by_id(value, id, found, element_check);
+        };
+
+        if (!get_option_by(short_id, short_id_is_set) || !get_option_by(long_id, long_id_is_set))
+            return false;
 
         // if value is no container we need to check for multiple declarations
         if (short_id_is_set && long_id_is_set && !detail::is_container_option<option_type>)
-            throw option_declared_multiple_times("Option " + combine_option_names(short_id, long_id) +
-                                                 " is no list/container but specified multiple times");
+        {
+            return fail(parse_error_kind::option_declared_multiple_times, last_value_position,
+                        combine_option_names(short_id, long_id), [] (parse_result const & result)
+            {
+                return "Option " + std::string{result.option_id()} + " is no list/container but specified multiple times";
+            });
+        }
 
         if (short_id_is_set || long_id_is_set)
         {
-            try
-            {
-                validator(value);
-            }
-            catch (std::exception & ex)
+            if (element_check.requires_validation()) // values checked while parsing are not validated again
             {
-                throw validation_error(std::string("Validation failed for option ") +
-                                        combine_option_names(short_id, long_id) + ": " + ex.what());
+                try
+                {
+                    validator(value);
+                }
+                catch (std::exception & ex)
+                {
+                    return fail(parse_error_kind::validation_error, last_value_position,
+                                combine_option_names(short_id, long_id),
+                                [what = std::string{ex.what()}] (parse_result const & result)
+                    {
+                        return "Validation failed for option " + std::string{result.option_id()} + ": " + what;
+                    });
+                }
             }
         }
-        else // option is not set
+        else if (spec & option_spec::required) // option is not set
         {
-            // check if option is required
-            if (spec & option_spec::required)
-                throw required_option_missing("Option " + combine_option_names(short_id, long_id) +
-                                              " is required but not set.");
+            return fail(parse_error_kind::required_option_missing, parse_result::npos,
+                        combine_option_names(short_id, long_id), [] (parse_result const & result)
+            {
+                return "Option " + std::string{result.option_id()} + " is required but not set.";
+            });
         }
+
+        return true;
     }
 
     /*!\brief Handles command line flags, whether they are set or not.
@@ -734,10 +1487,8 @@ private:
      * \param[out] value     The variable in which to store the given command line argument.
      * \param[in]  validator The validator applied to the value after parsing (callable).
      *
-     * \throws sharg::parser_error
-     * \throws sharg::too_few_arguments
-     * \throws sharg::validation_error
-     * \throws sharg::design_error
+     * \returns `false` if an error was recorded (sharg::parse_error_kind::too_few_arguments,
+     *          sharg::parse_error_kind::user_input_error or sharg::parse_error_kind::validation_error).
      *
      * \details
      *
@@ -745,75 +1496,210 @@ private:
      * -#) argv has been stripped from all known options and flags
      * -#) argv has been checked for unknown options
      * -#) argv does not contain "--" anymore
-     *  Thus we can simply iterate over non empty entries of argv.
+     *  Thus we can simply iterate over the arguments that are not consumed yet, starting at the cursor.
      *
      * This function
      * - checks if the user did not provide enough arguments,
-     * - retrieves the next (no container type) or all (container type) remaining non empty value/s in argv
+     * - retrieves the next (no container type) or all (container type) remaining value/s in argv
      */
     template <typename option_type, typename validator_type>
-    void get_positional_option(option_type & value,
+    bool get_positional_option(option_type & value,
                                validator_type && validator)
     {
         ++positional_option_count;
-        auto it = std::find_if(argv.begin(), argv.end(), [](std::string const & s){return (s != "");});
+        size_t position = next_unconsumed_argument();
+        auto element_check = make_element_check<option_type>(validator);
 
-        if (it == argv.end())
-            throw too_few_arguments("Not enough positional arguments provided (Need at least " +
-                                    std::to_string(positional_option_calls.size()) +
-                                    "). See -h/--help for more information.");
+        if (position == argv.size())
+        {
+            return fail(parse_error_kind::too_few_arguments, parse_result::npos, {},
+                        [total = positional_option_total] (parse_result const &)
+            {
+                return "Not enough positional arguments provided (Need at least " + std::to_string(total) +
+                       "). See -h/--help for more information.";
+            });
+        }
 
         if constexpr (detail::is_container_option<option_type>) // vector/list will be filled with all remaining arguments
         {
-            assert(positional_option_count == positional_option_calls.size()); // checked on set up.
+            assert(positional_option_count == positional_option_total); // checked on set up.
 
             value.clear();
+            reserve(value, std::count(consumed_arguments.begin() + position, consumed_arguments.end(), false));
 
-            while (it != argv.end())
+            for (size_t current = position; current != argv.size(); current = next_unconsumed_argument())
             {
-                auto res = parse_option_value(value, *it);
-                std::string id = "positional option" + std::to_string(positional_option_count);
-                throw_on_input_error<option_type>(res, id, *it);
-
-                *it = ""; // remove arg from argv
-                it = std::find_if(it, argv.end(), [](std::string const & s){return (s != "");});
+                position = current;
+                auto res = parse_option_value(value, argv[position]);
+
+                if (res == option_parse_result::success)
+                    element_check(value);
+                else if (!check_input_result<option_type>(res,
+                                                          "positional option" + std::to_string(positional_option_count),
+                                                          argv[position],
+                                                          position))
+                    return false;
+
+                consume_argument(position); // remove arg from argv
                 ++positional_option_count;
             }
         }
         else
         {
-            auto res = parse_option_value(value, *it);
+            auto res = parse_option_value(value, argv[position]);
             std::string id = "positional option" + std::to_string(positional_option_count);
-            throw_on_input_error<option_type>(res, id, *it);
+            if (!check_input_result<option_type>(res, id, argv[position], position))
+                return false;
 
-            *it = ""; // remove arg from argv
+            consume_argument(position); // remove arg from argv
         }
 
+        if (!element_check.requires_validation())
+            return true;
+
         try
         {
             validator(value);
         }
         catch (std::exception & ex)
         {
-            throw validation_error("Validation failed for positional option " +
-                                    std::to_string(positional_option_count) + ": " + ex.what());
+            return fail(parse_error_kind::validation_error, position,
+                        "positional option" + std::to_string(positional_option_count),
+                        [number = positional_option_count, what = std::string{ex.what()}] (parse_result const &)
+            {
+                return "Validation failed for positional option " + std::to_string(number) + ": " + what;
+            });
         }
+
+        return true;
+    }
+
+    /*!\brief Parses and validates all remaining arguments one by one and hands each over to `sink`.
+     * \tparam value_type The type of a single value.
+     * \param[in] sink A callable that takes a `value_type` rvalue.
+     * \param[in] validator The validator applied to each value.
+     * \returns `false` if an error was recorded, `true` otherwise.
+     *
+     * \details
+     *
+     * Like get_positional_option for a container, but no container is filled and there may be no value at all.
+     * If a value is invalid, the values before it have already been handed over. A parse context only validates the
+     * values and never calls `sink`.
+     */
+    template <typename value_type, typename sink_type, typename validator_type>
+    bool get_positional_sink(sink_type & sink, validator_type && validator)
+    {
+        ++positional_option_count;
+        size_t position = next_unconsumed_argument();
+
+        assert(positional_option_count == positional_option_total); // checked on set up.
+
+        for (; position != argv.size(); position = next_unconsumed_argument())
+        {
+            std::string id = "positional option" + std::to_string(positional_option_count);
+            value_type value{};
+
+            if (!check_input_result<value_type>(parse_option_value(value, argv[position]), id, argv[position], position))
+                return false;
+
+            try
+            {
+                validator(value);
+            }
+            catch (std::exception & ex)
+            {
+                return fail(parse_error_kind::validation_error, position, std::move(id),
+                            [number = positional_option_count, what = std::string{ex.what()}] (parse_result const &)
+                {
+                    return "Validation failed for positional option " + std::to_string(number) + ": " + what;
+                });
+            }
+
+            if (store_values)
+                sink(std::move(value));
+
+            consume_argument(position); // remove arg from argv
+            ++positional_option_count;
+        }
+
+        return true;
+    }
+
+    //!\brief The kind of an entry in format_parse::option_table.
+    enum class option_kind : uint8_t
+    {
+        option,           //!< Added via format_parse::add_option.
+        flag,             //!< Added via format_parse::add_flag.
+        positional_option //!< Added via format_parse::add_positional_option.
+    };
+
+    //!\brief Describes an option, flag or positional option that is evaluated when calling format_parse::parse().
+    struct option_descriptor
+    {
+        //!\brief Whether this is an option, flag or positional option.
+        option_kind kind;
+        //!\brief The short identifier (`'\0'` if not set or for positional options).
+        char short_id;
+        //!\brief The option specification.
+        option_spec spec;
+        //!\brief The long identifier (empty if not set or for positional options).
+        std::string long_id;
+        //!\brief Points to the value bound by the developer, its type is only known to `parse`.
+        void * value;
+        //!\brief Parses and validates the option (calls format_parse::get_option or get_positional_option).
+        small_function<bool(format_parse &, option_descriptor const &)> parse;
+        //!\brief Separates several values of a list option in one argument (`'\0'` if not set).
+        char list_delimiter{'\0'};
+    };
+
+    //!\brief Returns the option table of this format or, for a parse context, the one of its prototype.
+    std::vector<option_descriptor> const & descriptors() const noexcept
+    {
+        return (shared_option_table != nullptr) ? *shared_option_table : option_table;
     }
 
-    //!\brief Stores get_option calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> option_calls;
-    //!\brief Stores get_flag calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> flag_calls;
-    //!\brief Stores get_positional_option calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> positional_option_calls;
+    //!\brief Stores all options, flags and positional options in the order they were added.
+    std::vector<option_descriptor> option_table{};
+    //!\brief The option table of the prototype if this is a parse context (not owned).
+    std::vector<option_descriptor> const * shared_option_table{nullptr};
+    //!\brief The number of positional options that were added.
+    unsigned positional_option_total{0};
+    //!\brief Whether parsed values are assigned to the bound variables (`false` for a parse context).
+    bool store_values{true};
     //!\brief Keeps track of the number of specified positional options.
     unsigned positional_option_count{0};
+    //!\brief The first error that occurred while parsing.
+    parse_result error{};
+    //!\brief The position of the last option value that was retrieved, used to report validation errors.
+    size_t last_value_position{parse_result::npos};
     //!\brief Number of command line arguments.
     int argc;
-    //!\brief Vector of command line arguments.
-    std::vector<std::string> argv;
+    //!\brief Vector of command line arguments (views into the original command line).
+    std::vector<std::string_view> argv;
+    //!\brief The indices of arguments in the original `argv` that are not part of format_parse::argv (sorted).
+    std::vector<size_t> removed_argument_indices{};
     //!\brief Artificial end of argv if \-- was seen.
-    std::vector<std::string>::iterator end_of_options_it;
+    std::vector<std::string_view>::iterator end_of_options_it;
+    //!\brief Owned copies of arguments that had to be modified (i.e. short flag clusters), by position in argv.
+    std::unordered_map<size_t, std::string> materialised_arguments{};
+    //!\brief The kind of each argument in argv, see format_parse::build_id_index.
+    std::vector<argument_kind> argument_kinds{};
+    //!\brief Whether the argument at the respective position in argv was consumed (or is empty).
+    std::vector<bool> consumed_arguments{};
+    //!\brief All arguments before this position are consumed, see format_parse::next_unconsumed_argument.
+    size_t positional_cursor{0};
+    //!\brief Positions of arguments (before \--) that start with a short identifier, e.g. `-i`, `-i5` or `-abc`.
+    std::unordered_map<char, std::vector<size_t>> short_id_positions{};
+    //!\brief Positions of short clusters (e.g. `-abc`) that contain the respective character.
+    std::unordered_map<char, std::vector<size_t>> flag_cluster_positions{};
+    //!\brief Positions of arguments (before \--) with a long identifier, e.g. `--foo` or `--foo=bar`.
+    std::unordered_map<std::string_view, std::vector<size_t>> long_id_positions{};
+    //!\brief The schema of the parser, if it was declared with a sharg::option_schema.
+    std::optional<option_schema_view> schema{};
+    //!\brief Where the positions of each schema long identifier start in schema_long_id_positions.
+    std::vector<size_t> schema_long_id_offsets{};
+    //!\brief The positions of all schema long identifiers in format_parse::argv, grouped by their schema index.
+    std::vector<size_t> schema_long_id_positions{};
 };
 
 } // namespace sharg
@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::from_chars_integer.
+ */
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <sharg/std/charconv>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Returns whether all eight bytes of `chunk` are ASCII digits.
+ * \ingroup parser
+ */
+constexpr bool is_eight_digits(uint64_t const chunk) noexcept
+{
+    // A digit is 0x30 - 0x39: its high nibble is 3, and adding 6 does not carry into the high nibble.
+    return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+           0x3333333333333333;
+}
+
+/*!\brief Converts eight ASCII digits, loaded in little endian byte order, to their value.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The digits are combined pairwise in three multiplications (SWAR, SIMD within a register) instead of eight
+ * multiply-add steps.
+ */
+constexpr uint64_t parse_eight_digits(uint64_t chunk) noexcept
+{
+    constexpr uint64_t mask = 0x000000FF000000FF;
+    constexpr uint64_t mul1 = 100 + (1000000ULL << 32);
+    constexpr uint64_t mul2 = 1 + (10000ULL << 32);
+
+    chunk -= 0x3030303030303030;
+    chunk = (chunk * 10) + (chunk >> 8);                                      // pairs of digits
+    return (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32; // combine the four pairs
+}
+
+/*!\brief Parses a decimal integer like std::from_chars with base 10.
+ * \ingroup parser
+ * \tparam value_t The integral type to parse.
+ * \param[in]  first The begin of the input.
+ * \param[in]  last  The end of the input.
+ * \param[out] value The parsed value; unchanged on error.
+ * \returns The same result as `std::from_chars(first, last, value)`.
+ *
+ * \details
+ *
+ * If [`first`, `last`) consists only of at most 19 digits (with a leading `-` for signed types), the digits are
+ * converted eight at a time, see sharg::detail::parse_eight_digits. Everything else, e.g. trailing characters, is
+ * delegated to std::from_chars, so the result is the same in every case.
+ */
+template <std::integral value_t>
+    requires (!std::same_as<value_t, bool>)
+inline std::from_chars_result from_chars_integer(char const * const first,
+                                                 char const * const last,
+                                                 value_t & value) noexcept
+{
+    using unsigned_t = std::make_unsigned_t<value_t>;
+
+    char const * it = first;
+    bool negative{false};
+
+    if constexpr (std::is_signed_v<value_t>)
+    {
+        if (it != last && *it == '-')
+        {
+            negative = true;
+            ++it;
+        }
+    }
+
+    // 10^19 - 1 is the largest number of 19 digits and fits into 64 bit
+    if (it == last || last - it > 19)
+        return std::from_chars(first, last, value);
+
+    uint64_t magnitude{0};
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        for (; last - it >= 8; it += 8)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, it, sizeof(chunk));
+
+            if (!is_eight_digits(chunk))
+                return std::from_chars(first, last, value);
+
+            magnitude = magnitude * 100000000 + parse_eight_digits(chunk);
+        }
+    }
+
+    for (; it != last; ++it)
+    {
+        unsigned const digit = static_cast<unsigned char>(*it) - static_cast<unsigned char>('0');
+
+        if (digit > 9)
+            return std::from_chars(first, last, value);
+
+        magnitude = magnitude * 10 + digit;
+    }
+
+    uint64_t const limit = static_cast<uint64_t>(std::numeric_limits<value_t>::max()) + negative;
+
+    if (magnitude > limit)
+        return {last, std::errc::result_out_of_range};
+
+    // conversion to a signed type is modular (C++20), i.e. 0 - magnitude is the negative value
+    value = static_cast<value_t>(static_cast<unsigned_t>(negative ? 0 - magnitude : magnitude));
+    return {last, std::errc{}};
+}
+
+} // namespace sharg::detail
@@ -0,0 +1,717 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::regex_dfa.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A deterministic finite automaton that decides whether a string matches a regular expression.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The automaton is built once on construction (parse the pattern, build a Thompson NFA, determinise it via the
+ * subset construction). Afterwards, regex_dfa::match looks up one table entry per character, i.e. a string is checked
+ * in linear time without backtracking and without allocating memory.
+ *
+ * Like std::regex_match, the whole string must match. The following subset of the ECMAScript grammar is supported:
+ *
+ * - literals and escaped characters (`\.`, `\\`, `\t`, `\n`, ...), `.` (any character except `\n` and `\r`)
+ * - character classes `[a-z_]`, `[^/]`, and `\d`, `\D`, `\w`, `\W`, `\s`, `\S` (also within classes)
+ * - groups `(...)` and `(?:...)`, alternatives `|`
+ * - quantifiers `*`, `+`, `?`, `{m}`, `{m,}` and `{m,n}` (lazy variants are accepted, they match the same strings)
+ * - `^` at the very beginning and `$` at the very end of the pattern (they do not change a full match)
+ *
+ * Other features (back references, assertions, character class names, ...) throw a sharg::design_error, as do
+ * patterns whose automaton would become too large.
+ */
+class regex_dfa
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    regex_dfa() = delete;                              //!< Deleted.
+    regex_dfa(regex_dfa const &) = default;            //!< Defaulted.
+    regex_dfa & operator=(regex_dfa const &) = default; //!< Defaulted.
+    regex_dfa(regex_dfa &&) = default;                 //!< Defaulted.
+    regex_dfa & operator=(regex_dfa &&) = default;     //!< Defaulted.
+    ~regex_dfa() = default;                            //!< Defaulted.
+
+    /*!\brief Builds the automaton for `pattern`.
+     * \param[in] pattern The regular expression.
+     * \throws sharg::design_error if the pattern is invalid, uses an unsupported feature or is too complex.
+     */
+    explicit regex_dfa(std::string_view const pattern)
+    {
+        pattern_parser parser{pattern};
+        node const root = parser.parse();
+        thompson_nfa nfa{};
+        fragment const whole = nfa.compile(root);
+        nfa.states[whole.end].accepting = true;
+        determinise(nfa, whole.start);
+    }
+    //!\}
+
+    //!\brief Returns whether the whole string `str` matches the pattern.
+    bool match(std::string_view const str) const noexcept
+    {
+        uint32_t state{start_state};
+
+        for (char const c : str)
+        {
+            state = transitions[state * class_count + byte_class[static_cast<unsigned char>(c)]];
+
+            if (state == dead_state)
+                return false;
+        }
+
+        return accepting[state];
+    }
+
+    //!\brief The maximal number of states of the automaton.
+    static constexpr size_t max_states{4096};
+
+private:
+    //!\brief A set of bytes.
+    using char_set = std::bitset<256>;
+
+    //!\brief A node of the syntax tree.
+    struct node
+    {
+        //!\brief The kind of the node.
+        enum class kind_type : uint8_t
+        {
+            empty,       //!< Matches the empty string.
+            chars,       //!< Matches a single character in `chars`.
+            concat,      //!< Matches the concatenation of the children.
+            alternation, //!< Matches one of the children.
+            repeat       //!< Matches the child `[min, max]` times (`max == -1` means unbounded).
+        };
+
+        //!\brief The kind of the node.
+        kind_type kind{kind_type::empty};
+        //!\brief The characters of a chars node.
+        char_set chars{};
+        //!\brief The children of concat, alternation and repeat nodes.
+        std::vector<node> children{};
+        //!\brief The minimal number of repetitions.
+        int min{0};
+        //!\brief The maximal number of repetitions (-1 for unbounded).
+        int max{0};
+    };
+
+    //!\brief Throws the design error for an invalid or unsupported pattern.
+    [[noreturn]] static void unsupported(std::string_view const pattern, std::string const & reason)
+    {
+        throw design_error{"The pattern '" + std::string{pattern} + "' cannot be compiled to an automaton: " +
+                           reason + "."};
+    }
+
+    //!\brief A recursive descent parser for the supported subset of the ECMAScript grammar.
+    struct pattern_parser
+    {
+        //!\brief The pattern.
+        std::string_view pattern;
+        //!\brief The current position in the pattern.
+        size_t pos{0};
+
+        //!\brief Parses the whole pattern.
+        node parse()
+        {
+            if (pattern.starts_with('^'))
+                ++pos;
+
+            node result = parse_alternation();
+
+            if (pos < pattern.size() && pattern[pos] == '$' && pos + 1 == pattern.size())
+                ++pos;
+
+            if (pos != pattern.size())
+                unsupported(pattern, pattern[pos] == ')' ? "unbalanced parenthesis" : "unsupported character '" +
+                                                                                       std::string(1, pattern[pos]) +
+                                                                                       "'");
+            return result;
+        }
+
+        //!\brief Parses `concat ('|' concat)*`.
+        node parse_alternation()
+        {
+            node result{node::kind_type::alternation};
+            result.children.push_back(parse_concatenation());
+
+            while (pos < pattern.size() && pattern[pos] == '|')
+            {
+                ++pos;
+                result.children.push_back(parse_concatenation());
+            }
+
+            return result.children.size() == 1 ? std::move(result.children[0]) : std::move(result);
+        }
+
+        //!\brief Parses a sequence of quantified atoms.
+        node parse_concatenation()
+        {
+            node result{node::kind_type::concat};
+
+            while (pos < pattern.size() && pattern[pos] != '|' && pattern[pos] != ')')
+            {
+                if (pattern[pos] == '$' && pos + 1 == pattern.size()) // trailing anchor
+                    break;
+
+                result.children.push_back(parse_quantified());
+            }
+
+            return result;
+        }
+
+        //!\brief Parses an atom followed by any number of quantifiers.
+        node parse_quantified()
+        {
+            node result = parse_atom();
+
+            while (pos < pattern.size())
+            {
+                int min{};
+                int max{};
+                char const c = pattern[pos];
+
+                if (c == '*')
+                {
+                    min = 0;
+                    max = -1;
+                    ++pos;
+                }
+                else if (c == '+')
+                {
+                    min = 1;
+                    max = -1;
+                    ++pos;
+                }
+                else if (c == '?')
+                {
+                    min = 0;
+                    max = 1;
+                    ++pos;
+                }
+                else if (c == '{')
+                {
+                    ++pos;
+                    min = parse_number();
+                    max = min;
+
+                    if (pos < pattern.size() && pattern[pos] == ',')
+                    {
+                        ++pos;
+                        max = (pos < pattern.size() && pattern[pos] == '}') ? -1 : parse_number();
+                    }
+
+                    if (pos == pattern.size() || pattern[pos] != '}' || (max != -1 && max < min))
+                        unsupported(pattern, "invalid quantifier");
+                    ++pos;
+                }
+                else
+                {
+                    break;
+                }
+
+                if (pos < pattern.size() && pattern[pos] == '?') // lazy quantifier, matches the same strings
+                    ++pos;
+
+                node repeat{node::kind_type::repeat};
+                repeat.min = min;
+                repeat.max = max;
+                repeat.children.push_back(std::move(result));
+                result = std::move(repeat);
+            }
+
+            return result;
+        }
+
+        //!\brief Parses a decimal number of a quantifier.
+        int parse_number()
+        {
+            size_t const begin{pos};
+            int number{0};
+
+            while (pos < pattern.size() && pattern[pos] >= '0' && pattern[pos] <= '9')
+            {
+                number = number * 10 + (pattern[pos++] - '0');
+
+                if (number > 1000)
+                    unsupported(pattern, "quantifier is too large");
+            }
+
+            if (pos == begin)
+                unsupported(pattern, "invalid quantifier");
+
+            return number;
+        }
+
+        //!\brief Parses a group, a character class, `.`, an escape sequence or a literal.
+        node parse_atom()
+        {
+            char const c = pattern[pos++];
+            node result{node::kind_type::chars};
+
+            switch (c)
+            {
+                case '(':
+                {
+                    if (pattern.substr(pos).starts_with("?:"))
+                        pos += 2;
+                    else if (pos < pattern.size() && pattern[pos] == '?')
+                        unsupported(pattern, "assertions are not supported");
+
+                    result = parse_alternation();
+
+                    if (pos == pattern.size() || pattern[pos] != ')')
+                        unsupported(pattern, "unbalanced parenthesis");
+                    ++pos;
+                    return result;
+                }
+                case '[':
+                    result.chars = parse_class();
+                    return result;
+                case '.':
+                    result.chars.set();
+                    result.chars.reset('\n');
+                    result.chars.reset('\r');
+                    return result;
+                case '\\':
+                    result.chars = parse_escape();
+                    return result;
+                case '*': case '+': case '?': case '{':
+                    unsupported(pattern, "quantifier without a preceding expression");
+                case '^': case '$':
+                    unsupported(pattern, "anchors are only supported at the beginning and the end");
+                default:
+                    result.chars.set(static_cast<unsigned char>(c));
+                    return result;
+            }
+        }
+
+        //!\brief Parses the escape sequence after a backslash.
+        char_set parse_escape()
+        {
+            if (pos == pattern.size())
+                unsupported(pattern, "the pattern ends with a backslash");
+
+            char const c = pattern[pos++];
+            char_set result{};
+
+            auto set_range = [&result] (char const first, char const last)
+            {
+                for (int i = first; i <= last; ++i)
+                    result.set(static_cast<unsigned char>(i));
+            };
+
+            switch (c)
+            {
+                case 'd': case 'D':
+                    set_range('0', '9');
+                    break;
+                case 'w': case 'W':
+                    set_range('0', '9');
+                    set_range('a', 'z');
+                    set_range('A', 'Z');
+                    result.set('_');
+                    break;
+                case 's': case 'S':
+                    for (char const space : {' ', '\t', '\n', '\r', '\v', '\f'})
+                        result.set(static_cast<unsigned char>(space));
+                    break;
+                case 't': result.set('\t'); return result;
+                case 'n': result.set('\n'); return result;
+                case 'r': result.set('\r'); return result;
+                case 'v': result.set('\v'); return result;
+                case 'f': result.set('\f'); return result;
+                default:
+                    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+                        unsupported(pattern, "the escape sequence \\" + std::string(1, c) + " is not supported");
+                    result.set(static_cast<unsigned char>(c)); // escaped punctuation
+                    return result;
+            }
+
+            if (c == 'D' || c == 'W' || c == 'S')
+                result.flip();
+
+            return result;
+        }
+
+        //!\brief Parses a character class after `[`.
+        char_set parse_class()
+        {
+            char_set result{};
+            bool const negated = pos < pattern.size() && pattern[pos] == '^';
+            pos += negated;
+
+            while (true)
+            {
+                if (pos == pattern.size())
+                    unsupported(pattern, "unterminated character class");
+
+                if (pattern[pos] == ']')
+                    break;
+
+                if (pattern.substr(pos).starts_with("[:") || pattern.substr(pos).starts_with("[=") ||
+                    pattern.substr(pos).starts_with("[."))
+                {
+                    unsupported(pattern, "character class names are not supported");
+                }
+
+                bool is_single{true};
+                char_set const first = parse_class_atom(is_single);
+
+                // a range like a-z (a '-' before ']' is a literal)
+                if (is_single && pos + 1 < pattern.size() && pattern[pos] == '-' && pattern[pos + 1] != ']')
+                {
+                    ++pos;
+                    bool last_is_single{true};
+                    char_set const last = parse_class_atom(last_is_single);
+
+                    if (!last_is_single)
+                        unsupported(pattern, "invalid range in character class");
+
+                    size_t const from = first_char(first);
+                    size_t const to = first_char(last);
+
+                    if (from > to)
+                        unsupported(pattern, "invalid range in character class");
+
+                    for (size_t i = from; i <= to; ++i)
+                        result.set(i);
+                }
+                else
+                {
+                    result |= first;
+                }
+            }
+
+            ++pos; // ']'
+            return negated ? ~result : result;
+        }
+
+        //!\brief Returns the smallest character in `set`.
+        static size_t first_char(char_set const & set)
+        {
+            size_t i{0};
+            while (i < set.size() && !set.test(i))
+                ++i;
+            return i;
+        }
+
+        //!\brief Parses a single character or an escape sequence in a character class.
+        char_set parse_class_atom(bool & is_single)
+        {
+            char const c = pattern[pos++];
+
+            if (c != '\\')
+            {
+                char_set result{};
+                result.set(static_cast<unsigned char>(c));
+                return result;
+            }
+
+            if (pos < pattern.size() && pattern[pos] == 'b') // backspace in a class
+            {
+                ++pos;
+                char_set result{};
+                result.set('\b');
+                return result;
+            }
+
+            char_set result = parse_escape();
+            is_single = result.count() == 1;
+            return result;
+        }
+    };
+
+    //!\brief A part of the NFA with a single start and a single end state.
+    struct fragment
+    {
+        //!\brief The start state.
+        uint32_t start;
+        //!\brief The end state.
+        uint32_t end;
+    };
+
+    //!\brief A Thompson NFA: each state has at most one character transition and any number of epsilon transitions.
+    struct thompson_nfa
+    {
+        //!\brief A state of the NFA.
+        struct state
+        {
+            //!\brief The characters of the character transition (empty if there is none).
+            char_set chars{};
+            //!\brief The target of the character transition.
+            uint32_t next{0};
+            //!\brief The targets of the epsilon transitions.
+            std::vector<uint32_t> epsilon{};
+            //!\brief Whether this is the accepting state.
+            bool accepting{false};
+        };
+
+        //!\brief The states.
+        std::vector<state> states{};
+
+        //!\brief The maximal number of NFA states.
+        static constexpr size_t max_nfa_states{20000};
+
+        //!\brief Adds a state.
+        uint32_t add_state()
+        {
+            if (states.size() == max_nfa_states)
+                throw design_error{"The pattern is too complex to be compiled to an automaton."};
+
+            states.emplace_back();
+            return static_cast<uint32_t>(states.size() - 1);
+        }
+
+        //!\brief Adds an epsilon transition.
+        void connect(uint32_t const from, uint32_t const to)
+        {
+            states[from].epsilon.push_back(to);
+        }
+
+        //!\brief Builds the fragment for `n`.
+        fragment compile(node const & n)
+        {
+            switch (n.kind)
+            {
+                case node::kind_type::chars:
+                {
+                    fragment const result{add_state(), add_state()};
+                    states[result.start].chars = n.chars;
+                    states[result.start].next = result.end;
+                    return result;
+                }
+                case node::kind_type::concat:
+                {
+                    uint32_t const start = add_state();
+                    uint32_t end = start;
+
+                    for (node const & child : n.children)
+                    {
+                        fragment const part = compile(child);
+                        connect(end, part.start);
+                        end = part.end;
+                    }
+
+                    return {start, end};
+                }
+                case node::kind_type::alternation:
+                {
+                    fragment const result{add_state(), add_state()};
+
+                    for (node const & child : n.children)
+                    {
+                        fragment const part = compile(child);
+                        connect(result.start, part.start);
+                        connect(part.end, result.end);
+                    }
+
+                    return result;
+                }
+                case node::kind_type::repeat:
+                {
+                    uint32_t const start = add_state();
+                    uint32_t end = start;
+
+                    for (int i = 0; i < n.min; ++i)
+                    {
+                        fragment const part = compile(n.children[0]);
+                        connect(end, part.start);
+                        end = part.end;
+                    }
+
+                    if (n.max == -1)
+                    {
+                        fragment const part = compile(n.children[0]);
+                        uint32_t const loop_end = add_state();
+                        connect(end, part.start);
+                        connect(end, loop_end);
+                        connect(part.end, part.start);
+                        connect(part.end, loop_end);
+                        end = loop_end;
+                    }
+                    else
+                    {
+                        uint32_t const optional_end = add_state();
+
+                        for (int i = n.min; i < n.max; ++i)
+                        {
+                            fragment const part = compile(n.children[0]);
+                            connect(end, part.start);
+                            connect(end, optional_end);
+                            end = part.end;
+                        }
+
+                        connect(end, optional_end);
+                        end = optional_end;
+                    }
+
+                    return {start, end};
+                }
+                default: // empty
+                {
+                    uint32_t const state = add_state();
+                    return {state, state};
+                }
+            }
+        }
+
+        //!\brief Adds all states reachable via epsilon transitions to the sorted set `set`.
+        void epsilon_closure(std::vector<uint32_t> & set) const
+        {
+            std::vector<uint32_t> stack{set};
+            std::vector<bool> seen(states.size(), false);
+
+            for (uint32_t const s : set)
+                seen[s] = true;
+
+            while (!stack.empty())
+            {
+                uint32_t const current = stack.back();
+                stack.pop_back();
+
+                for (uint32_t const target : states[current].epsilon)
+                {
+                    if (!seen[target])
+                    {
+                        seen[target] = true;
+                        set.push_back(target);
+                        stack.push_back(target);
+                    }
+                }
+            }
+
+            std::ranges::sort(set);
+        }
+    };
+
+    //!\brief Computes the byte classes and the transition table via the subset construction.
+    void determinise(thompson_nfa const & nfa, uint32_t const nfa_start)
+    {
+        compute_byte_classes(nfa);
+
+        // a representative byte for each class
+        std::vector<unsigned char> representative(class_count);
+        for (size_t b = 256; b > 0; --b)
+            representative[byte_class[b - 1]] = static_cast<unsigned char>(b - 1);
+
+        std::map<std::vector<uint32_t>, uint32_t> ids{};
+        std::vector<std::vector<uint32_t>> sets{};
+
+        auto add_dfa_state = [&] (std::vector<uint32_t> set) -> uint32_t
+        {
+            auto [it, inserted] = ids.try_emplace(set, static_cast<uint32_t>(sets.size()));
+
+            if (inserted)
+            {
+                if (sets.size() == max_states)
+                    throw design_error{"The pattern is too complex to be compiled to an automaton."};
+
+                bool const is_accepting = std::ranges::any_of(set, [&nfa] (uint32_t const s)
+                {
+                    return nfa.states[s].accepting;
+                });
+                sets.push_back(std::move(set));
+                accepting.push_back(is_accepting);
+                transitions.resize(transitions.size() + class_count, dead_state);
+            }
+
+            return it->second;
+        };
+
+        add_dfa_state({}); // the dead state has id 0
+
+        std::vector<uint32_t> start_set{nfa_start};
+        nfa.epsilon_closure(start_set);
+        start_state = add_dfa_state(std::move(start_set));
+
+        for (uint32_t current = 1; current < sets.size(); ++current)
+        {
+            for (size_t cls = 0; cls < class_count; ++cls)
+            {
+                std::vector<uint32_t> next{};
+
+                for (uint32_t const s : sets[current])
+                    if (nfa.states[s].chars.test(representative[cls]))
+                        next.push_back(nfa.states[s].next);
+
+                if (next.empty())
+                    continue;
+
+                std::ranges::sort(next);
+                next.erase(std::unique(next.begin(), next.end()), next.end());
+                nfa.epsilon_closure(next);
+
+                uint32_t const target = add_dfa_state(std::move(next));
+                transitions[current * class_count + cls] = target; // no reference is held across the resize
+            }
+        }
+    }
+
+    //!\brief Partitions the bytes into classes that no character set of the NFA distinguishes.
+    void compute_byte_classes(thompson_nfa const & nfa)
+    {
+        // bytes with the same signature (membership in every distinct set) are in the same class
+        std::vector<char_set> distinct_sets{};
+
+        for (auto const & state : nfa.states)
+            if (state.chars.any() && std::ranges::find(distinct_sets, state.chars) == distinct_sets.end())
+                distinct_sets.push_back(state.chars);
+
+        std::map<std::vector<bool>, uint8_t> classes{};
+
+        for (size_t b = 0; b < 256; ++b)
+        {
+            std::vector<bool> signature(distinct_sets.size());
+
+            for (size_t i = 0; i < distinct_sets.size(); ++i)
+                signature[i] = distinct_sets[i].test(b);
+
+            auto [it, inserted] = classes.try_emplace(std::move(signature), static_cast<uint8_t>(classes.size()));
+            byte_class[b] = it->second;
+        }
+
+        class_count = classes.size();
+    }
+
+    //!\brief The id of the dead state, i.e. no match is possible anymore.
+    static constexpr uint32_t dead_state{0};
+
+    //!\brief The class of each byte.
+    std::array<uint8_t, 256> byte_class{};
+    //!\brief The number of byte classes.
+    size_t class_count{1};
+    //!\brief The transition table, `transitions[state * class_count + class]` is the next state.
+    std::vector<uint32_t> transitions{};
+    //!\brief Whether a state is accepting.
+    std::vector<bool> accepting{};
+    //!\brief The start state.
+    uint32_t start_state{dead_state};
+};
+
+} // namespace sharg::detail
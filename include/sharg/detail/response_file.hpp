@@ -0,0 +1,247 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::response_file_expander.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef _WIN32
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#else
+#   include <filesystem>
+#   include <fstream>
+#   include <iterator>
+#endif
+
+#include <sharg/detail/shell_tokenizer.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Expands response files (`@file`) on the command line.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * An argument `@path` is replaced by the arguments in the file `path`, which are split like a POSIX shell would do it
+ * (see sharg::detail::split_command_line). Response files may refer to other response files; a response file that
+ * (indirectly) refers to itself is an error. Relative paths are resolved against the current working directory.
+ * As in GCC, an argument `@path` is kept as it is if `path` cannot be opened. If `path` is not a regular file (e.g. a
+ * FIFO or `/dev/stdin`), it is an error; the file is never read, so the expansion does not block.
+ *
+ * Arguments after the first `--` (on the command line or in a response file) are positional arguments and are not
+ * expanded.
+ *
+ * The files are memory mapped and the arguments are views into the mapping, unless they contain quotes or escapes.
+ * The mappings are owned by the expander, i.e. it must outlive the expanded arguments.
+ * Moving the expander does not invalidate the arguments.
+ */
+class response_file_expander
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    response_file_expander() = default;                                           //!< Defaulted.
+    response_file_expander(response_file_expander const &) = delete;              //!< Deleted.
+    response_file_expander & operator=(response_file_expander const &) = delete;  //!< Deleted.
+    response_file_expander(response_file_expander &&) = default;                  //!< Defaulted.
+    response_file_expander & operator=(response_file_expander &&) = default;      //!< Defaulted.
+    ~response_file_expander() = default;                                          //!< Defaulted.
+    //!\}
+
+    //!\brief Whether no response file was expanded so far.
+    bool empty() const noexcept
+    {
+        return files.empty();
+    }
+
+    //!\brief Whether `argument` refers to a response file, i.e. it starts with `@`.
+    static bool is_response_file(std::string_view const argument) noexcept
+    {
+        return argument.size() > 1 && argument[0] == '@';
+    }
+
+    /*!\brief Appends `argument` to `arguments` or, if it refers to a response file, the arguments in the file.
+     * \param[in]     argument  The argument to expand.
+     * \param[in,out] arguments The expanded arguments are appended to this vector.
+     * \throws sharg::user_input_error if a response file is not a regular file, refers to itself or contains an
+     *         unterminated quote.
+     */
+    void expand(std::string_view const argument, std::vector<std::string_view> & arguments)
+    {
+        if (end_of_options || !is_response_file(argument))
+        {
+            end_of_options = end_of_options || argument == "--";
+            arguments.push_back(argument);
+            return;
+        }
+
+        std::unique_ptr<mapped_file> file = mapped_file::open(std::string{argument.substr(1)});
+
+        if (file == nullptr) // not a file, keep the argument
+        {
+            arguments.push_back(argument);
+            return;
+        }
+
+        if (std::find(open_files.begin(), open_files.end(), file->id) != open_files.end())
+            throw user_input_error{"The response file " + std::string{argument.substr(1)} + " includes itself."};
+
+        std::vector<std::string_view> file_arguments{};
+
+        if (!split_command_line(file->contents(), file->buffer, file_arguments))
+        {
+            throw user_input_error{"The response file " + std::string{argument.substr(1)} +
+                                   " contains an unterminated quote or ends with a backslash."};
+        }
+
+        open_files.push_back(file->id);
+        files.push_back(std::move(file));
+
+        for (std::string_view const file_argument : file_arguments)
+            expand(file_argument, arguments);
+
+        open_files.pop_back();
+    }
+
+private:
+    //!\brief A read-only memory mapped file.
+    struct mapped_file
+    {
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        mapped_file() = default;                                //!< Defaulted.
+        mapped_file(mapped_file const &) = delete;              //!< Deleted.
+        mapped_file & operator=(mapped_file const &) = delete;  //!< Deleted.
+        mapped_file(mapped_file &&) = delete;                   //!< Deleted.
+        mapped_file & operator=(mapped_file &&) = delete;       //!< Deleted.
+
+        //!\brief Unmaps the file.
+        ~mapped_file()
+        {
+#ifndef _WIN32
+            if (data != nullptr)
+                munmap(const_cast<char *>(data), size);
+#endif
+        }
+        //!\}
+
+        /*!\brief Maps the file at `path` or returns `nullptr` if it cannot be opened.
+         * \throws sharg::user_input_error if `path` is not a regular file.
+         */
+        static std::unique_ptr<mapped_file> open(std::string const & path)
+        {
+            auto file = std::make_unique<mapped_file>();
+#ifndef _WIN32
+            // O_NONBLOCK: opening a FIFO must not wait for a writer; it is rejected below.
+            int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+
+            if (fd < 0)
+                return nullptr;
+
+            struct stat status{};
+            if (fstat(fd, &status) != 0)
+            {
+                close(fd);
+                return nullptr;
+            }
+
+            if (!S_ISREG(status.st_mode))
+            {
+                close(fd);
+                throw_not_a_regular_file(path);
+            }
+
+            file->id = std::to_string(status.st_dev) + ':' + std::to_string(status.st_ino);
+            file->size = static_cast<size_t>(status.st_size);
+
+            if (file->size > 0)
+            {
+                void * const mapping = mmap(nullptr, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (mapping == MAP_FAILED)
+                {
+                    close(fd);
+                    return nullptr;
+                }
+
+                file->data = static_cast<char const *>(mapping);
+            }
+
+            close(fd); // the mapping stays valid
+#else
+            std::error_code error{};
+            std::filesystem::path const canonical_path = std::filesystem::canonical(path, error);
+
+            if (error)
+                return nullptr;
+
+            if (!std::filesystem::is_regular_file(canonical_path))
+                throw_not_a_regular_file(path);
+
+            std::ifstream stream{path, std::ios::binary};
+
+            if (!stream.good())
+                return nullptr;
+
+            file->id = canonical_path.string();
+            file->copy.assign(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{});
+            file->data = file->copy.data();
+            file->size = file->copy.size();
+#endif
+            return file;
+        }
+
+        //!\brief Throws the error for a response file that is not a regular file.
+        [[noreturn]] static void throw_not_a_regular_file(std::string const & path)
+        {
+            throw user_input_error{"The response file " + path + " is not a regular file."};
+        }
+
+        //!\brief The contents of the file.
+        std::string_view contents() const noexcept
+        {
+            return {data, size};
+        }
+
+        //!\brief Identifies the file (device and inode), used to detect cycles.
+        std::string id{};
+        //!\brief The mapped file contents.
+        char const * data{nullptr};
+        //!\brief The size of the file.
+        size_t size{0};
+        //!\brief Storage for arguments that contain quotes or escapes.
+        std::string buffer{};
+#ifdef _WIN32
+        //!\brief The file contents (no memory mapping on Windows).
+        std::string copy{};
+#endif
+    };
+
+    //!\brief The expanded response files.
+    std::vector<std::unique_ptr<mapped_file>> files{};
+    //!\brief The identifiers of the response files that are currently expanded.
+    std::vector<std::string> open_files{};
+    //!\brief Whether `--` was expanded, i.e. the remaining arguments are not expanded.
+    bool end_of_options{false};
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,151 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::split_command_line.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+//!\brief Whether `c` separates two words of a command line.
+inline constexpr bool is_command_line_space(char const c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/*!\brief Splits a command line into arguments like a POSIX shell.
+ * \ingroup parser
+ * \param[in]     input     The command line(s).
+ * \param[in,out] buffer    Storage for arguments that contain quotes or escapes; its previous content is discarded.
+ * \param[in,out] arguments The arguments are appended to this vector.
+ * \returns `false` if a quote is not closed or the input ends with a backslash, `true` otherwise.
+ *
+ * \details
+ *
+ * The following rules of the POSIX shell are implemented:
+ *
+ * - Arguments are separated by white space (including newlines).
+ * - A backslash outside of quotes preserves the next character; a backslash followed by a newline is removed.
+ * - Characters in single quotes are preserved.
+ * - In double quotes, a backslash only escapes `"`, `\`, `$`, `` ` `` and newline.
+ * - A `#` at the beginning of an argument starts a comment that ends at the next newline.
+ *
+ * Variables, globs and other expansions are not performed.
+ *
+ * The arguments are views into `input` if they do not contain quotes or escapes, and views into `buffer`
+ * otherwise. So `input` and `buffer` must outlive `arguments` and `buffer` must not be modified in between.
+ * No memory is allocated apart from growing `arguments` and reserving `input.size()` bytes in `buffer`.
+ */
+inline bool split_command_line(std::string_view const input,
+                               std::string & buffer,
+                               std::vector<std::string_view> & arguments)
+{
+    buffer.clear();
+    buffer.reserve(input.size()); // unquoting never grows an argument, so views into buffer stay valid
+
+    size_t i{0};
+    size_t const size{input.size()};
+
+    while (true)
+    {
+        // a line continuation between arguments is white space, e.g. the indentation after it does not start an
+        // (empty) argument
+        while (i < size && (is_command_line_space(input[i]) || input.substr(i, 2) == "\\\n"))
+            i += (input[i] == '\\') ? 2 : 1;
+
+        if (i == size)
+            return true;
+
+        if (input[i] == '#')
+        {
+            while (i < size && input[i] != '\n')
+                ++i;
+            continue;
+        }
+
+        // fast path: an argument without quotes or escapes is a view into input
+        size_t const start{i};
+        while (i < size && !is_command_line_space(input[i]) && input[i] != '\'' && input[i] != '"' && input[i] != '\\')
+            ++i;
+
+        if (i == size || is_command_line_space(input[i]))
+        {
+            arguments.push_back(input.substr(start, i - start));
+            continue;
+        }
+
+        size_t const argument_begin{buffer.size()};
+        buffer.append(input.substr(start, i - start));
+
+        while (i < size && !is_command_line_space(input[i]))
+        {
+            char const c = input[i++];
+
+            if (c == '\\')
+            {
+                if (i == size)
+                    return false;
+
+                if (input[i] != '\n') // line continuation
+                    buffer.push_back(input[i]);
+                ++i;
+            }
+            else if (c == '\'')
+            {
+                size_t const end = input.find('\'', i);
+
+                if (end == std::string_view::npos)
+                    return false;
+
+                buffer.append(input.substr(i, end - i));
+                i = end + 1;
+            }
+            else if (c == '"')
+            {
+                while (true)
+                {
+                    if (i == size)
+                        return false;
+
+                    char const quoted = input[i++];
+
+                    if (quoted == '"')
+                        break;
+
+                    if (quoted == '\\' && i < size &&
+                        (input[i] == '"' || input[i] == '\\' || input[i] == '$' || input[i] == '`' || input[i] == '\n'))
+                    {
+                        if (input[i] != '\n')
+                            buffer.push_back(input[i]);
+                        ++i;
+                    }
+                    else
+                    {
+                        buffer.push_back(quoted);
+                    }
+                }
+            }
+            else
+            {
+                buffer.push_back(c);
+            }
+        }
+
+        arguments.push_back(std::string_view{buffer}.substr(argument_begin));
+    }
+}
+
+} // namespace sharg::detail
@@ -0,0 +1,225 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::small_function.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+//!\cond
+template <typename signature_t, size_t buffer_size = 64>
+class small_function;
+//!\endcond
+
+/*!\brief A copyable, type-erased callable that stores small callables without a heap allocation.
+ * \ingroup parser
+ * \tparam return_t    The return type of the call operator.
+ * \tparam args_t      The argument types of the call operator.
+ * \tparam buffer_size The size of the in-place buffer in bytes.
+ *
+ * \details
+ *
+ * This is a light-weight alternative to std::function. Callables that fit into `buffer_size` bytes (and are
+ * nothrow move constructible) are stored in-place, larger ones are stored on the heap. Instead of a virtual
+ * interface, each stored type provides a static table of function pointers, such that a call is a single
+ * indirect jump.
+ */
+template <typename return_t, typename ...args_t, size_t buffer_size>
+class small_function<return_t(args_t...), buffer_size>
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    small_function() = default; //!< Defaulted.
+
+    //!\brief Copy constructor.
+    small_function(small_function const & other) : ops{other.ops}
+    {
+        if (ops != nullptr)
+            ops->copy(other.storage, storage);
+    }
+
+    //!\brief Move constructor.
+    small_function(small_function && other) noexcept : ops{other.ops}
+    {
+        if (ops != nullptr)
+        {
+            ops->move(other.storage, storage);
+            other.ops = nullptr;
+        }
+    }
+
+    //!\brief Copy assignment.
+    small_function & operator=(small_function const & other)
+    {
+        if (this != &other)
+        {
+            small_function tmp{other};
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    //!\brief Move assignment.
+    small_function & operator=(small_function && other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            ops = other.ops;
+
+            if (ops != nullptr)
+            {
+                ops->move(other.storage, storage);
+                other.ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    //!\brief Destroys the stored callable.
+    ~small_function()
+    {
+        reset();
+    }
+
+    /*!\brief Constructs from a callable.
+     * \tparam callable_t The type of the callable; must be copy constructible and invocable with `args_t...`.
+     * \param[in] callable The callable to store.
+     */
+    template <typename callable_t>
+    //!\cond
+        requires (!std::same_as<std::remove_cvref_t<callable_t>, small_function>) &&
+                 std::copy_constructible<std::remove_cvref_t<callable_t>> &&
+                 std::is_invocable_r_v<return_t, std::remove_cvref_t<callable_t> const &, args_t...>
+    //!\endcond
+    small_function(callable_t && callable) // NOLINT(google-explicit-constructor)
+    {
+        using stored_t = std::remove_cvref_t<callable_t>;
+
+        if constexpr (is_stored_in_place<stored_t>)
+            ::new (static_cast<void *>(storage)) stored_t(std::forward<callable_t>(callable));
+        else
+            ::new (static_cast<void *>(storage)) stored_t *(new stored_t(std::forward<callable_t>(callable)));
+
+        ops = &operations_for<stored_t>;
+    }
+    //!\}
+
+    //!\brief Invokes the stored callable. The behaviour is undefined if no callable is stored.
+    return_t operator()(args_t ...args) const
+    {
+        assert(ops != nullptr);
+        return ops->invoke(storage, std::forward<args_t>(args)...);
+    }
+
+    //!\brief Returns whether a callable is stored.
+    explicit operator bool() const noexcept
+    {
+        return ops != nullptr;
+    }
+
+    //!\brief Whether a callable of type `callable_t` would be stored without a heap allocation.
+    template <typename callable_t>
+    static constexpr bool is_stored_in_place = sizeof(callable_t) <= buffer_size &&
+                                               alignof(std::max_align_t) % alignof(callable_t) == 0 &&
+                                               std::is_nothrow_move_constructible_v<callable_t>;
+
+private:
+    //!\brief The table of type-specific operations.
+    struct operations
+    {
+        //!\brief Calls the stored callable.
+        return_t (*invoke)(std::byte const *, args_t && ...);
+        //!\brief Copy constructs the callable in the first buffer into the second.
+        void (*copy)(std::byte const *, std::byte *);
+        //!\brief Move constructs the callable in the first buffer into the second and destroys the source.
+        void (*move)(std::byte *, std::byte *) noexcept;
+        //!\brief Destroys the stored callable.
+        void (*destroy)(std::byte *) noexcept;
+    };
+
+    //!\brief Returns the stored callable of type `stored_t`.
+    template <typename stored_t>
+    static stored_t const & get(std::byte const * buffer)
+    {
+        if constexpr (is_stored_in_place<stored_t>)
+            return *std::launder(reinterpret_cast<stored_t const *>(buffer));
+        else
+            return **std::launder(reinterpret_cast<stored_t * const *>(buffer));
+    }
+
+    //!\brief The operations for the callable type `stored_t`.
+    template <typename stored_t>
+    static constexpr operations operations_for
+    {
+        .invoke = [] (std::byte const * buffer, args_t && ...args) -> return_t
+        {
+            return std::invoke(get<stored_t>(buffer), std::forward<args_t>(args)...);
+        },
+        .copy = [] (std::byte const * source, std::byte * target)
+        {
+            if constexpr (is_stored_in_place<stored_t>)
+                ::new (static_cast<void *>(target)) stored_t(get<stored_t>(source));
+            else
+                ::new (static_cast<void *>(target)) stored_t *(new stored_t(get<stored_t>(source)));
+        },
+        .move = [] (std::byte * source, std::byte * target) noexcept
+        {
+            if constexpr (is_stored_in_place<stored_t>)
+            {
+                stored_t * source_ptr = std::launder(reinterpret_cast<stored_t *>(source));
+                ::new (static_cast<void *>(target)) stored_t(std::move(*source_ptr));
+                source_ptr->~stored_t();
+            }
+            else // the pointer is just handed over
+            {
+                ::new (static_cast<void *>(target)) stored_t *(*std::launder(reinterpret_cast<stored_t **>(source)));
+            }
+        },
+        .destroy = [] (std::byte * buffer) noexcept
+        {
+            if constexpr (is_stored_in_place<stored_t>)
+                std::launder(reinterpret_cast<stored_t *>(buffer))->~stored_t();
+            else
+                delete *std::launder(reinterpret_cast<stored_t **>(buffer));
+        }
+    };
+
+    //!\brief Destroys the stored callable, if any.
+    void reset() noexcept
+    {
+        if (ops != nullptr)
+        {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+    //!\brief The in-place storage of the callable (or a pointer to it).
+    alignas(std::max_align_t) std::byte storage[buffer_size < sizeof(void *) ? sizeof(void *) : buffer_size];
+    //!\brief The operations of the stored type or `nullptr` if empty.
+    operations const * ops{nullptr};
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,167 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::scan_special_arguments.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <sharg/parse_result.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The information that a special argument (e.g. `--help`) asks the application to print instead of parsing.
+ * \ingroup parser
+ */
+enum class special_format : uint8_t
+{
+    none,          //!< No special argument was given; the command line is parsed.
+    help,          //!< `-h/--help`.
+    advanced_help, //!< `-hh/--advanced-help`.
+    version,       //!< `--version`.
+    copyright,     //!< `--copyright`.
+    export_html,   //!< `--export-help html`.
+    export_man     //!< `--export-help man`.
+};
+
+/*!\brief The result of sharg::detail::scan_special_arguments.
+ * \ingroup parser
+ */
+struct special_arguments
+{
+    //!\brief The last special argument on the command line; special_format::none if there is none.
+    special_format format{special_format::none};
+    //!\brief The value of `--version-check`, if given.
+    std::optional<bool> version_check{};
+    //!\brief The arguments that are passed on to sharg::detail::format_parse.
+    std::vector<std::string_view> remaining{};
+    //!\brief The indices (with the program name at index 0) of the arguments that are not passed on.
+    std::vector<size_t> removed_indices{};
+    //!\brief The first invalid special argument; parse_result::success() is `true` if there is none.
+    parse_result error{};
+};
+
+/*!\brief Separates the arguments that every application understands from the ones that are parsed.
+ * \ingroup parser
+ * \param[in] arguments The command line arguments without the program name.
+ * \returns The special arguments that were found and the remaining arguments.
+ *
+ * \details
+ *
+ * These are `-h/--help`, `-hh/--advanced-help`, `--version`, `--copyright`, `--export-help` and `--version-check`.
+ * The scan stops at the first invalid value of `--export-help` or `--version-check`; the argument index of the error
+ * counts the program name as index 0. Used by sharg::parser (which throws the error) and sharg::parser_schema (which
+ * returns it).
+ */
+inline special_arguments scan_special_arguments(std::vector<std::string_view> arguments)
+{
+    special_arguments result{};
+    size_t kept{0};
+
+    for (size_t i = 0; i < arguments.size(); ++i)
+    {
+        std::string_view const arg = arguments[i];
+
+        if (arg == "-h" || arg == "--help")
+        {
+            result.format = special_format::help;
+        }
+        else if (arg == "-hh" || arg == "--advanced-help")
+        {
+            result.format = special_format::advanced_help;
+        }
+        else if (arg == "--version")
+        {
+            result.format = special_format::version;
+        }
+        else if (arg == "--copyright")
+        {
+            result.format = special_format::copyright;
+        }
+        else if (arg.substr(0, 13) == "--export-help") // --export-help=man is also allowed
+        {
+            if (arg.size() <= 13 && arguments.size() <= i + 1)
+            {
+                result.error = {parse_error_kind::too_few_arguments, i + 1, "export-help", [] (parse_result const &)
+                {
+                    return std::string{"Option --export-help must be followed by a value."};
+                }};
+                return result;
+            }
+
+            std::string_view const export_format = (arg.size() > 13) ? arg.substr(14) : arguments[i + 1];
+
+            if (export_format == "html")
+            {
+                result.format = special_format::export_html;
+            }
+            else if (export_format == "man")
+            {
+                result.format = special_format::export_man;
+            }
+            else
+            {
+                result.error = {parse_error_kind::validation_error, i + 1, "export-help", [] (parse_result const &)
+                {
+                    return std::string{"Validation failed for option --export-help: Value must be one of [html, man]"};
+                }};
+                return result;
+            }
+        }
+        else if (arg == "--version-check")
+        {
+            if (++i >= arguments.size())
+            {
+                result.error = {parse_error_kind::too_few_arguments, i, "version-check", [] (parse_result const &)
+                {
+                    return std::string{"Option --version-check must be followed by a value."};
+                }};
+                return result;
+            }
+
+            std::string_view const value = arguments[i];
+
+            if (value == "1" || value == "true")
+            {
+                result.version_check = true;
+            }
+            else if (value == "0" || value == "false")
+            {
+                result.version_check = false;
+            }
+            else
+            {
+                result.error = {parse_error_kind::validation_error, i + 1, "version-check", [] (parse_result const &)
+                {
+                    return std::string{"Value for option --version-check must be true (1) or false (0)."};
+                }};
+                return result;
+            }
+
+            // --version-check and its value are not passed on to format_parse
+            result.removed_indices.push_back(i);
+            result.removed_indices.push_back(i + 1);
+        }
+        else
+        {
+            arguments[kept++] = arg;
+        }
+    }
+
+    arguments.resize(kept);
+    result.remaining = std::move(arguments);
+    return result;
+}
+
+} // namespace sharg::detail
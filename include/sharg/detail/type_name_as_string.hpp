@@ -16,9 +16,10 @@
 #include <cxxabi.h>
 #endif // defined(__GNUC__) || defined(__clang__)
 
-#include <functional>
+#include <cstdlib>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 
 #include <sharg/platform.hpp>
@@ -26,7 +27,7 @@
 namespace sharg::detail
 {
 
-/*!\brief Defines the human-readable name of the given type using the
+/*!\brief Returns the human-readable name of the given type using the
           [typeid](https://en.cppreference.com/w/cpp/language/typeid) operator.
  *
  * \tparam type The type to get the human-readable name for.
@@ -37,44 +38,53 @@ namespace sharg::detail
  * The mangled name can be converted to human-readable form using implementation-specific API such as
  * abi::__cxa_demangle. In other implementations the name returned is already human-readable.
  *
+ * The name is only needed for help pages and error messages. It is therefore computed on the first call and not
+ * during the dynamic initialisation of the program; the initialisation of the function-local static is thread-safe.
+ *
  * \note The returned name is implementation defined and might change between different tool chains.
  */
 template <typename type>
-inline std::string const type_name_as_string = [] ()
+std::string const & type_name_as_string()
 {
-    std::string demangled_name{};
+    static std::string const name = [] ()
+    {
+        std::string demangled_name{};
 #if defined(__GNUC__) || defined(__clang__) // clang and gcc only return a mangled name.
-    using safe_ptr_t = std::unique_ptr<char, std::function<void(char *)>>;
+        auto free_name = [] (char * name_ptr) { free(name_ptr); };
 
-    // https://gcc.gnu.org/onlinedocs/libstdc++/libstdc++-html-USERS-4.3/a01696.html
-    int status{};
-    safe_ptr_t demangled_name_ptr{abi::__cxa_demangle(typeid(type).name(), 0, 0, &status),
-                                  [] (char * name_ptr) { free(name_ptr); }};
+        // https://gcc.gnu.org/onlinedocs/libstdc++/libstdc++-html-USERS-4.3/a01696.html
+        int status{};
+        std::unique_ptr<char, decltype(free_name)> demangled_name_ptr{
+            abi::__cxa_demangle(typeid(type).name(), 0, 0, &status), free_name};
 
-    // We exclude status != 0, because this code can't be reached normally, only if there is a defect in the compiler
-    // itself, since the type is directly given by the compiler. See https://github.com/seqan/seqan3/pull/2311.
-    // LCOV_EXCL_START
-    if (status != 0)
-        return std::string{typeid(type).name()} +
-               " (abi::__cxa_demangle error status (" + std::to_string(status) + "): " +
-               (status == -1 ? "A memory allocation failure occurred." :
-               (status == -2 ? "mangled_name is not a valid name under the C++ ABI mangling rules." :
-               (status == -3 ? "One of the arguments is invalid." : "Unknown Error"))) + ")";
-    // LCOV_EXCL_STOP
+        // We exclude status != 0, because this code can't be reached normally, only if there is a defect in the
+        // compiler itself, since the type is directly given by the compiler.
+        // See https://github.com/seqan/seqan3/pull/2311.
+        // LCOV_EXCL_START
+        if (status != 0)
+            return std::string{typeid(type).name()} +
+                   " (abi::__cxa_demangle error status (" + std::to_string(status) + "): " +
+                   (status == -1 ? "A memory allocation failure occurred." :
+                   (status == -2 ? "mangled_name is not a valid name under the C++ ABI mangling rules." :
+                   (status == -3 ? "One of the arguments is invalid." : "Unknown Error"))) + ")";
+        // LCOV_EXCL_STOP
 
-    demangled_name = std::string{std::addressof(*demangled_name_ptr)};
+        demangled_name = std::string{std::addressof(*demangled_name_ptr)};
 #else // e.g. MSVC
-    demangled_name = typeid(type).name();
+        demangled_name = typeid(type).name();
 #endif // defined(__GNUC__) || defined(__clang__)
 
-    if constexpr (std::is_const_v<std::remove_reference_t<type>>)
-        demangled_name += " const";
-    if constexpr (std::is_lvalue_reference_v<type>)
-        demangled_name += " &";
-    if constexpr (std::is_rvalue_reference_v<type>)
-        demangled_name += " &&";
+        if constexpr (std::is_const_v<std::remove_reference_t<type>>)
+            demangled_name += " const";
+        if constexpr (std::is_lvalue_reference_v<type>)
+            demangled_name += " &";
+        if constexpr (std::is_rvalue_reference_v<type>)
+            demangled_name += " &&";
+
+        return demangled_name;
+    }();
 
-    return demangled_name;
-}();
+    return name;
+}
 
 }  // namespace sharg::detail
@@ -18,9 +18,9 @@
 #include <future>
 #include <iostream>
 #include <optional>
-#include <regex>
 
 #include <sharg/auxiliary.hpp>
+#include <sharg/detail/char_class.hpp>
 #include <sharg/detail/safe_filesystem_entry.hpp>
 #include <sharg/detail/terminal.hpp>
 
@@ -73,7 +73,7 @@ public:
     version_checker(std::string name_, std::string const & version_, std::string const & app_url = std::string{}) :
         name{std::move(name_)}
     {
-        assert(std::regex_match(name, std::regex{"^[a-zA-Z0-9_-]+$"})); // check on construction of the parser
+        assert(is_valid_app_name(name)); // check on construction of the parser
 
         if (!app_url.empty())
         {
@@ -86,14 +86,9 @@ public:
 #else
         timestamp_filename = cookie_path / (name + "_dev.timestamp");
 #endif
-        std::smatch versionMatch;
-
-        // Ensure version string is not corrupt
-        if (!version_.empty() && /*regex allows version prefix instead of exact match */
-            std::regex_search(version_, versionMatch, std::regex("^([[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+).*")))
-        {
-            version = versionMatch.str(1); // in case the git revision number is given take only version number
-        }
+        // Ensure version string is not corrupt; a version prefix is allowed instead of an exact match.
+        if (size_t const length = version_prefix_length(version_); length > 0)
+            version = version_.substr(0, length); // in case the git revision number is given take only version number
     }
     //!\}
 
@@ -438,8 +433,6 @@ public:
     std::string name;
     //!\brief The version of the application.
     std::string version{"0.0.0"};
-    //!\brief The regex to verify a valid version string.
-    std::regex version_regex{"^[[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+$"};
     //!\brief The path to store timestamp and version files (either ~/.config/seqan or the tmp directory).
     std::filesystem::path cookie_path = get_path();
     //!\brief The timestamp filename.
@@ -481,13 +474,13 @@ private:
     }
 
     /*!\brief Parses a version string into an array of length 3.
-     * \param[in] str The version string that must match sharg::detail::version_regex.
+     * \param[in] str The version string that must consist of exactly three numbers separated by `.`.
      */
     std::array<int, 3> get_numbers_from_version_string(std::string const & str) const
     {
         std::array<int, 3> result{};
 
-        if (!std::regex_match(str, version_regex))
+        if (str.empty() || version_prefix_length(str) != str.size())
             return result;
 
         auto res = std::from_chars(str.data(), str.data() + str.size(), result[0]); // stops and sets res.ptr at '.'
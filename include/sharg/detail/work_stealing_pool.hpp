@@ -0,0 +1,278 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::detail::work_stealing_pool.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A thread pool that processes a range of indices with work stealing.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * work_stealing_pool::run splits the indices `[0, task_count)` evenly among the workers (the calling thread is one
+ * of them). Each worker processes its own range from the front. A worker that runs out of work steals the back half
+ * of the range of another worker. Hence, the workers stay busy even if the cost of the tasks is very uneven, while
+ * the synchronisation cost is one uncontended lock per task.
+ *
+ * The threads are started once on construction and wait for the next call to run().
+ */
+class work_stealing_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    work_stealing_pool() = delete;                                       //!< Deleted.
+    work_stealing_pool(work_stealing_pool const &) = delete;             //!< Deleted.
+    work_stealing_pool & operator=(work_stealing_pool const &) = delete; //!< Deleted.
+    work_stealing_pool(work_stealing_pool &&) = delete;                  //!< Deleted.
+    work_stealing_pool & operator=(work_stealing_pool &&) = delete;      //!< Deleted.
+
+    /*!\brief Starts `thread_count - 1` threads.
+     * \param[in] thread_count The number of workers including the calling thread; 0 is treated as 1.
+     */
+    explicit work_stealing_pool(size_t const thread_count) :
+        worker_count{std::max<size_t>(thread_count, 1)},
+        ranges{std::make_unique<task_range[]>(worker_count)}
+    {
+        threads.reserve(worker_count - 1);
+
+        for (size_t worker = 1; worker < worker_count; ++worker)
+            threads.emplace_back([this, worker] () { wait_for_work(worker); });
+    }
+
+    //!\brief Stops and joins all threads.
+    ~work_stealing_pool()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+        start_condition.notify_all();
+
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+    //!\}
+
+    /*!\brief Whether the current thread is processing a task of a work_stealing_pool.
+     *
+     * \details
+     *
+     * Code that may run inside a task (e.g. a validator called by sharg::validate_batch) uses this to avoid starting a
+     * nested pool, which would oversubscribe the machine.
+     */
+    static bool is_worker_thread() noexcept
+    {
+        return worker_flag();
+    }
+
+    //!\brief The number of workers, including the calling thread.
+    size_t size() const noexcept
+    {
+        return worker_count;
+    }
+
+    /*!\brief Calls `task(index)` for every index in `[0, task_count)` and returns when all calls have finished.
+     * \param[in] task_count The number of tasks.
+     * \param[in] task       A callable that is invoked concurrently with different indices.
+     * \throws Rethrows the first exception thrown by `task` (the remaining tasks are still processed).
+     *
+     * \details
+     *
+     * Must not be called concurrently.
+     */
+    template <typename task_t>
+    void run(size_t const task_count, task_t & task)
+    {
+        {
+            std::lock_guard lock{mutex};
+
+            current_task = &task;
+            invoke_task = [] (void * task_ptr, size_t const index) { (*static_cast<task_t *>(task_ptr))(index); };
+            first_exception = nullptr;
+
+            for (size_t worker = 0; worker < worker_count; ++worker)
+            {
+                ranges[worker].begin = task_count * worker / worker_count;
+                ranges[worker].end = task_count * (worker + 1) / worker_count;
+            }
+
+            active_workers = worker_count - 1;
+            ++generation;
+        }
+        start_condition.notify_all();
+
+        work(0);
+
+        std::unique_lock lock{mutex};
+        done_condition.wait(lock, [this] () { return active_workers == 0; });
+
+        if (first_exception)
+            std::rethrow_exception(first_exception);
+    }
+
+private:
+    //!\brief The indices `[begin, end)` that are left for a worker.
+    struct alignas(64) task_range
+    {
+        //!\brief Protects begin and end.
+        std::mutex mutex{};
+        //!\brief The next index to process.
+        size_t begin{};
+        //!\brief One past the last index to process.
+        size_t end{};
+    };
+
+    //!\brief The loop of the started threads.
+    void wait_for_work(size_t const worker)
+    {
+        size_t seen_generation{0};
+
+        while (true)
+        {
+            {
+                std::unique_lock lock{mutex};
+                start_condition.wait(lock, [&] () { return stop || generation != seen_generation; });
+
+                if (stop)
+                    return;
+
+                seen_generation = generation;
+            }
+
+            work(worker);
+
+            {
+                std::lock_guard lock{mutex};
+                --active_workers;
+            }
+            done_condition.notify_one();
+        }
+    }
+
+    //!\brief The flag returned by is_worker_thread().
+    static bool & worker_flag() noexcept
+    {
+        thread_local bool is_worker{false};
+        return is_worker;
+    }
+
+    //!\brief Processes tasks until there are none left to steal.
+    void work(size_t const worker)
+    {
+        // also set for the calling thread of run(), which may itself be a worker of another pool
+        struct worker_scope_t
+        {
+            bool previous{std::exchange(worker_flag(), true)};
+            ~worker_scope_t() { worker_flag() = previous; }
+        } const worker_scope{};
+
+        size_t index{};
+
+        while (next_index(worker, index))
+        {
+            try
+            {
+                invoke_task(current_task, index);
+            }
+            catch (...)
+            {
+                std::lock_guard lock{mutex};
+                if (!first_exception)
+                    first_exception = std::current_exception();
+            }
+        }
+    }
+
+    //!\brief Takes the next index from the own range or steals half of the range of another worker.
+    bool next_index(size_t const worker, size_t & index)
+    {
+        {
+            task_range & own = ranges[worker];
+            std::lock_guard lock{own.mutex};
+
+            if (own.begin < own.end)
+            {
+                index = own.begin++;
+                return true;
+            }
+        }
+
+        for (size_t offset = 1; offset < worker_count; ++offset)
+        {
+            task_range & victim = ranges[(worker + offset) % worker_count];
+            size_t stolen_begin{};
+            size_t stolen_end{};
+
+            {
+                std::lock_guard lock{victim.mutex};
+
+                if (victim.begin == victim.end)
+                    continue;
+
+                stolen_begin = victim.begin + (victim.end - victim.begin) / 2;
+                stolen_end = victim.end;
+                victim.end = stolen_begin;
+            }
+
+            task_range & own = ranges[worker];
+            std::lock_guard lock{own.mutex};
+            own.begin = stolen_begin + 1;
+            own.end = stolen_end;
+            index = stolen_begin;
+            return true;
+        }
+
+        return false;
+    }
+
+    //!\brief The number of workers, including the calling thread.
+    size_t worker_count;
+    //!\brief The range of each worker.
+    std::unique_ptr<task_range[]> ranges;
+    //!\brief The started threads (worker 1 to worker_count - 1).
+    std::vector<std::thread> threads{};
+
+    //!\brief Protects all members below.
+    std::mutex mutex{};
+    //!\brief Signals a new call to run() or stop.
+    std::condition_variable start_condition{};
+    //!\brief Signals that a thread finished its work.
+    std::condition_variable done_condition{};
+    //!\brief Incremented on every call to run().
+    size_t generation{0};
+    //!\brief The number of started threads that are still working on the current call to run().
+    size_t active_workers{0};
+    //!\brief Whether the threads shall terminate.
+    bool stop{false};
+    //!\brief The task of the current call to run().
+    void * current_task{nullptr};
+    //!\brief Invokes current_task.
+    void (*invoke_task)(void *, size_t){nullptr};
+    //!\brief The first exception thrown by a task.
+    std::exception_ptr first_exception{};
+};
+
+} // namespace sharg::detail
@@ -12,10 +12,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 
+#include <sharg/exceptions.hpp>
 #include <sharg/platform.hpp>
 
 namespace sharg::custom
@@ -167,6 +171,102 @@ struct enumeration_names_cpo
 namespace sharg
 {
 
+/*!\brief A name table for sharg::enumeration_names that is sorted once and looked up without allocating.
+ * \tparam option_t The type of the values.
+ * \tparam size     The number of names.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The table stores the names in an array sorted by name; find() is a binary search. Since the table can be
+ * constructed in a constant expression, it can be provided as a `static constexpr` member (or returned from a
+ * `constexpr` function) instead of a std::unordered_map. Use sharg::make_enumeration_name_table to deduce the size:
+ *
+ * ```cpp
+ * namespace foo
+ * {
+ * enum class bar { one, two, three };
+ *
+ * constexpr auto enumeration_names(bar)
+ * {
+ *     return sharg::make_enumeration_name_table<bar>({{"one", bar::one}, {"two", bar::two}, {"three", bar::three}});
+ * }
+ * } // namespace foo
+ * ```
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+template <typename option_t, size_t size>
+class enumeration_name_table
+{
+public:
+    //!\brief A name and its value.
+    using value_type = std::pair<std::string_view, option_t>;
+    //!\brief The iterator type; iterates the names in sorted order.
+    using const_iterator = typename std::array<value_type, size>::const_iterator;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr enumeration_name_table() = delete;                                                 //!< Deleted.
+    constexpr enumeration_name_table(enumeration_name_table const &) = default;                  //!< Defaulted.
+    constexpr enumeration_name_table(enumeration_name_table &&) = default;                       //!< Defaulted.
+    constexpr enumeration_name_table & operator=(enumeration_name_table const &) = default;      //!< Defaulted.
+    constexpr enumeration_name_table & operator=(enumeration_name_table &&) = default;            //!< Defaulted.
+    ~enumeration_name_table() = default;                                                         //!< Defaulted.
+
+    /*!\brief Constructs the table from names and values in any order.
+     * \param[in] names The names and their values; a value may have several names.
+     * \throws sharg::design_error if a name is given twice (a compile time error in a constant expression).
+     */
+    constexpr enumeration_name_table(value_type const (&names)[size]) : entries{std::to_array(names)}
+    {
+        std::ranges::sort(entries, {}, &value_type::first);
+
+        if (std::ranges::adjacent_find(entries, {}, &value_type::first) != entries.end())
+            throw design_error{"The names of an enumeration must be unique."};
+    }
+    //!\}
+
+    /*!\brief Returns the entry of `name` or end() if there is none.
+     * \param[in] name The name to look up.
+     */
+    constexpr const_iterator find(std::string_view const name) const noexcept
+    {
+        const_iterator const it = std::ranges::lower_bound(entries, name, {}, &value_type::first);
+        return (it != entries.end() && it->first == name) ? it : entries.end();
+    }
+
+    //!\brief Returns an iterator to the first name.
+    constexpr const_iterator begin() const noexcept
+    {
+        return entries.begin();
+    }
+
+    //!\brief Returns an iterator behind the last name.
+    constexpr const_iterator end() const noexcept
+    {
+        return entries.end();
+    }
+
+private:
+    //!\brief The names and values, sorted by name.
+    std::array<value_type, size> entries;
+};
+
+/*!\brief Creates a sharg::enumeration_name_table, deducing its size.
+ * \tparam option_t The type of the values; must be given explicitly.
+ * \param[in] names The names and their values.
+ * \throws sharg::design_error if a name is given twice (a compile time error in a constant expression).
+ * \ingroup parser
+ */
+template <typename option_t, size_t size>
+constexpr enumeration_name_table<option_t, size>
+make_enumeration_name_table(std::pair<std::string_view, option_t> const (&names)[size])
+{
+    return enumeration_name_table<option_t, size>{names};
+}
+
 /*!\name Customisation Points
  * \{
  */
@@ -174,7 +274,8 @@ namespace sharg
 /*!\brief Return a conversion map from std::string_view to option_type.
  * \tparam your_type Type of the value to retrieve the conversion map for.
  * \param value The value is not accessed, only its type is used.
- * \returns A std::unordered_map<std::string_view, your_type> that maps a string identifier to a value of your_type.
+ * \returns A std::unordered_map<std::string_view, your_type> (or a sharg::enumeration_name_table) that maps a string
+ *          identifier to a value of your_type.
  * \ingroup parser
  * \details
  *
@@ -187,6 +288,10 @@ namespace sharg
  *   2. A free function `enumeration_names(your_type const a)` in the namespace of your type (or as `friend`) which
  *      returns a `std::unordered_map<std::string_view, your_type>>`.
  *
+ * Instead of a std::unordered_map, both may provide a sharg::enumeration_name_table, which can be built at compile
+ * time and is looked up without allocating. In general, any range of name/value pairs works; if it has a member
+ * `find(std::string_view)`, it is used to look up names.
+ *
  * ### Example
  *
  * If you are working on a type in your namespace, you should implement a free function like this:
@@ -219,8 +324,8 @@ inline auto const enumeration_names = detail::adl_only::enumeration_names_cpo<op
  *
  * ### Requirements
  *
- * * An instance of sharg::enumeration_names<option_type> must exist and be of the type
- *   `std::unordered_map<std::string, option_type>`.
+ * * An instance of sharg::enumeration_names<option_type> must exist and be a range of name/value pairs, e.g.
+ *   `std::unordered_map<std::string_view, option_type>` or sharg::enumeration_name_table.
  *
  * \remark For a complete overview, take a look at \ref parser
  */
@@ -239,7 +344,7 @@ template <typename option_type>
     requires sharg::named_enumeration<std::remove_cvref_t<option_type>>
 inline ostream & operator<<(ostream & s, option_type && op)
 {
-    for (auto & [key, value] : sharg::enumeration_names<option_type>)
+    for (auto const & [key, value] : sharg::enumeration_names<option_type>)
     {
         if (op == value)
             return s << key;
@@ -0,0 +1,325 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+  * \brief Provides sharg::input_file_handle and sharg::output_file_handle.
+ */
+
+#pragma once
+
+#include <charconv>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#ifndef _WIN32
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+#include <sharg/enumeration_names.hpp>
+#include <sharg/platform.hpp>
+
+namespace sharg
+{
+
+/*!\brief An option type for an input file that is opened by its validator.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The option value is a path. When the option is validated with sharg::input_file_open_validator, the validator
+ * opens the file, checks the opened file and keeps it open. The application then reads from descriptor() (or
+ * contents() if the file was memory mapped) instead of opening the path a second time. Hence, the file that is read
+ * is the file that was validated, even if the path is replaced in between.
+ *
+ * Copies of a handle share the opened file; it is closed (and unmapped) when the last copy is destroyed.
+ * Assigning a new path (e.g. when parsing) detaches the handle from the previously opened file.
+ *
+ * Without sharg::input_file_open_validator, the handle only stores the path and is_open() returns `false`.
+ * Opening files is only supported on POSIX systems.
+ */
+class input_file_handle
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    input_file_handle() = default;                                      //!< Defaulted.
+    input_file_handle(input_file_handle const &) = default;             //!< Defaulted.
+    input_file_handle & operator=(input_file_handle const &) = default; //!< Defaulted.
+    input_file_handle(input_file_handle &&) = default;                  //!< Defaulted.
+    input_file_handle & operator=(input_file_handle &&) = default;      //!< Defaulted.
+    ~input_file_handle() = default;                                     //!< Defaulted.
+
+    //!\brief Constructs a handle for `path` that is not opened yet.
+    explicit input_file_handle(std::filesystem::path path) : file_path{std::move(path)}
+    {}
+    //!\}
+
+    //!\brief The path of the file.
+    std::filesystem::path const & path() const noexcept
+    {
+        return file_path;
+    }
+
+    //!\brief Whether the file was opened by the validator.
+    bool is_open() const noexcept
+    {
+        return file != nullptr && file->descriptor >= 0;
+    }
+
+    //!\brief The open file descriptor (read only) or -1 if the file is not open. The handle owns the descriptor.
+    int descriptor() const noexcept
+    {
+        return is_open() ? file->descriptor : -1;
+    }
+
+    //!\brief The contents of the file if it was memory mapped; empty otherwise.
+    std::string_view contents() const noexcept
+    {
+        return (file != nullptr) ? std::string_view{file->data, file->size} : std::string_view{};
+    }
+
+    //!\brief Reads the path; the whole remaining input is the path, i.e. it may contain white space.
+    friend std::istream & operator>>(std::istream & stream, input_file_handle & handle)
+    {
+        std::string path{};
+        std::getline(stream, path, '\0');
+        handle = input_file_handle{path};
+        return stream;
+    }
+
+    //!\brief Prints the path like std::filesystem::path does, i.e. quoted.
+    friend std::ostream & operator<<(std::ostream & stream, input_file_handle const & handle)
+    {
+        return stream << handle.file_path;
+    }
+
+private:
+    //!\brief The validator opens the file.
+    friend class input_file_open_validator;
+
+    //!\brief An open file and its mapping; closed on destruction.
+    struct open_file
+    {
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        open_file() = default;                              //!< Defaulted.
+        open_file(open_file const &) = delete;              //!< Deleted.
+        open_file & operator=(open_file const &) = delete;  //!< Deleted.
+        open_file(open_file &&) = delete;                   //!< Deleted.
+        open_file & operator=(open_file &&) = delete;       //!< Deleted.
+
+        //!\brief Unmaps and closes the file.
+        ~open_file()
+        {
+#ifndef _WIN32
+            if (data != nullptr)
+                munmap(const_cast<char *>(data), size);
+
+            if (descriptor >= 0)
+                close(descriptor);
+#endif
+        }
+        //!\}
+
+        //!\brief The file descriptor.
+        int descriptor{-1};
+        //!\brief The mapped contents or `nullptr`.
+        char const * data{nullptr};
+        //!\brief The size of the mapping.
+        size_t size{0};
+    };
+
+    //!\brief Attaches an opened file to this handle and all its copies that share the (empty) state.
+    void attach(int const descriptor, char const * const data, size_t const size) const
+    {
+        file->descriptor = descriptor;
+        file->data = data;
+        file->size = size;
+    }
+
+    //!\brief The path of the file.
+    std::filesystem::path file_path{};
+    //!\brief The opened file; shared by copies so that the validator can open the file of a parsed value.
+    std::shared_ptr<open_file> file{std::make_shared<open_file>()};
+};
+
+/*!\brief An option type for an output file that is created by its validator.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The option value is a path. When the option is validated with sharg::output_file_open_validator, the validator
+ * creates the file (atomically with `O_EXCL` for sharg::output_file_open_options::create_new) and keeps it open for
+ * writing. The application writes to descriptor() instead of creating the path again, so no other process can take
+ * the name between the validation and the application creating the file.
+ *
+ * Copies of a handle share the open file; it is closed when the last copy is destroyed. The file is kept, even if
+ * nothing was written to it. Only if the parse fails (e.g. because of another option), a file that the validator
+ * created during the parse is removed again if it is still empty. sharg::parser_schema::validate does not create
+ * any files.
+ *
+ * Without sharg::output_file_open_validator, the handle only stores the path and is_open() returns `false`.
+ * Creating files is only supported on POSIX systems.
+ */
+class output_file_handle
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    output_file_handle() = default;                                       //!< Defaulted.
+    output_file_handle(output_file_handle const &) = default;             //!< Defaulted.
+    output_file_handle & operator=(output_file_handle const &) = default; //!< Defaulted.
+    output_file_handle(output_file_handle &&) = default;                  //!< Defaulted.
+    output_file_handle & operator=(output_file_handle &&) = default;      //!< Defaulted.
+    ~output_file_handle() = default;                                      //!< Defaulted.
+
+    //!\brief Constructs a handle for `path` that is not opened yet.
+    explicit output_file_handle(std::filesystem::path path) : file_path{std::move(path)}
+    {}
+    //!\}
+
+    //!\brief The path of the file.
+    std::filesystem::path const & path() const noexcept
+    {
+        return file_path;
+    }
+
+    //!\brief Whether the file was opened by the validator.
+    bool is_open() const noexcept
+    {
+        return file != nullptr && file->descriptor >= 0;
+    }
+
+    //!\brief The open file descriptor (write only) or -1 if the file is not open. The handle owns the descriptor.
+    int descriptor() const noexcept
+    {
+        return is_open() ? file->descriptor : -1;
+    }
+
+    //!\brief Whether the validator created the file (in contrast to opening an existing one).
+    bool created() const noexcept
+    {
+        return file != nullptr && file->created;
+    }
+
+    //!\brief Reads the path; the whole remaining input is the path, i.e. it may contain white space.
+    friend std::istream & operator>>(std::istream & stream, output_file_handle & handle)
+    {
+        std::string path{};
+        std::getline(stream, path, '\0');
+        handle = output_file_handle{path};
+        return stream;
+    }
+
+    //!\brief Prints the path like std::filesystem::path does, i.e. quoted.
+    friend std::ostream & operator<<(std::ostream & stream, output_file_handle const & handle)
+    {
+        return stream << handle.file_path;
+    }
+
+private:
+    //!\brief The validator creates the file.
+    friend class output_file_open_validator;
+
+    //!\brief An open file; closed on destruction.
+    struct open_file
+    {
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        open_file() = default;                              //!< Defaulted.
+        open_file(open_file const &) = delete;              //!< Deleted.
+        open_file & operator=(open_file const &) = delete;  //!< Deleted.
+        open_file(open_file &&) = delete;                   //!< Deleted.
+        open_file & operator=(open_file &&) = delete;       //!< Deleted.
+
+        //!\brief Closes the file.
+        ~open_file()
+        {
+#ifndef _WIN32
+            if (descriptor >= 0)
+                close(descriptor);
+#endif
+        }
+        //!\}
+
+        //!\brief Removes the file if it was created and nothing was written; called if the parse fails.
+        void remove_if_empty() noexcept
+        {
+#ifndef _WIN32
+            struct stat opened{};
+            struct stat at_path{};
+
+            // only remove the file that was created, not a file that replaced it in the meantime
+            if (created && descriptor >= 0 && fstat(descriptor, &opened) == 0 && opened.st_size == 0 &&
+                stat(path.c_str(), &at_path) == 0 && opened.st_dev == at_path.st_dev && opened.st_ino == at_path.st_ino)
+            {
+                unlink(path.c_str());
+            }
+#endif
+        }
+
+        //!\brief The file descriptor.
+        int descriptor{-1};
+        //!\brief Whether the validator created the file.
+        bool created{false};
+        //!\brief The path the file was created at.
+        std::filesystem::path path{};
+    };
+
+    //!\brief Attaches an opened file to this handle and all its copies that share the (empty) state.
+    void attach(int const descriptor, bool const created) const
+    {
+        file->descriptor = descriptor;
+        file->created = created;
+        file->path = file_path;
+    }
+
+    //!\brief The path of the file.
+    std::filesystem::path file_path{};
+    //!\brief The opened file; shared by copies so that the validator can open the file of a parsed value.
+    std::shared_ptr<open_file> file{std::make_shared<open_file>()};
+};
+
+} // namespace sharg
+
+namespace sharg::custom
+{
+
+//!\brief Parses a sharg::input_file_handle without a stream, see sharg::from_chars.
+template <>
+struct parsing<sharg::input_file_handle>
+{
+    //!\brief The whole argument is the path.
+    static std::from_chars_result from_chars(std::string_view const in, sharg::input_file_handle & handle)
+    {
+        handle = sharg::input_file_handle{std::filesystem::path{in}};
+        return {in.data() + in.size(), std::errc{}};
+    }
+};
+
+//!\brief Parses a sharg::output_file_handle without a stream, see sharg::from_chars.
+template <>
+struct parsing<sharg::output_file_handle>
+{
+    //!\brief The whole argument is the path.
+    static std::from_chars_result from_chars(std::string_view const in, sharg::output_file_handle & handle)
+    {
+        handle = sharg::output_file_handle{std::filesystem::path{in}};
+        return {in.data() + in.size(), std::errc{}};
+    }
+};
+
+} // namespace sharg::custom
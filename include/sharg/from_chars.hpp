@@ -0,0 +1,173 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::from_chars and sharg::from_chars_parsable.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <string_view>
+
+#include <sharg/std/charconv>
+
+#include <sharg/enumeration_names.hpp>
+
+namespace sharg::detail::adl_only
+{
+
+//!\brief Poison-pill overload to prevent non-ADL forms of unqualified lookup.
+template <typename t>
+std::from_chars_result from_chars(std::string_view, t &) = delete;
+
+//!\brief Customization Point Object (CPO) definition for sharg::from_chars.
+//!\ingroup parser
+//!\remark For a complete overview, take a look at \ref parser
+struct from_chars_cpo
+{
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr from_chars_cpo() = default; //!< Defaulted.
+    constexpr from_chars_cpo(from_chars_cpo &&) = default; //!< Defaulted.
+    constexpr from_chars_cpo(from_chars_cpo const &) = default; //!< Defaulted.
+    constexpr from_chars_cpo & operator=(from_chars_cpo &&) = default; //!< Defaulted.
+    constexpr from_chars_cpo & operator=(from_chars_cpo const &) = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief CPO overload (check 1 out of 2): explicit customisation via `sharg::custom::parsing`
+     * \tparam option_type The type of the option.
+     */
+    template <typename option_type>
+    static constexpr auto cpo_overload(sharg::detail::priority_tag<1>, std::string_view const in, option_type & value)
+    noexcept(noexcept(sharg::custom::parsing<option_type>::from_chars(in, value)))
+      -> decltype(sharg::custom::parsing<option_type>::from_chars(in, value))
+    {
+        return sharg::custom::parsing<option_type>::from_chars(in, value);
+    }
+
+    /*!\brief CPO overload (check 2 out of 2): argument dependent lookup (ADL), i.e. `from_chars(in, value)`
+     * \tparam option_type The type of the option.
+     */
+    template <typename option_type>
+    static constexpr auto cpo_overload(sharg::detail::priority_tag<0>, std::string_view const in, option_type & value)
+    noexcept(noexcept(from_chars(in, value)))
+      -> decltype(from_chars(in, value))
+    {
+        return from_chars(in, value);
+    }
+
+    /*!\brief SFINAE-friendly call-operator to resolve the CPO overload.
+     *
+     * This operator decides which `cpo_overload` implementation to use. It will start with the highest
+     * priority, in this case `sharg::detail::priority_tag<1>`. If this is not well-defined, the base class
+     * of the priority_tag is checked (`sharg::detail::priority_tag<0>`).
+     *
+     * If any matching overload is found, this operator perfectly forwards the result and noexcept-property of the
+     * `cpo_overload`.
+     */
+    template <typename option_type>
+    constexpr auto operator()(std::string_view const in, option_type & value) const
+    noexcept(noexcept(cpo_overload(sharg::detail::priority_tag<1>{}, in, value)))
+      -> decltype(cpo_overload(sharg::detail::priority_tag<1>{}, in, value))
+    {
+        return cpo_overload(sharg::detail::priority_tag<1>{}, in, value);
+    }
+};
+
+} // namespace sharg::detail::adl_only
+
+namespace sharg
+{
+
+/*!\name Customisation Points
+ * \{
+ */
+
+/*!\brief Parses a command line argument into a value without a stream.
+ * \param[in]  in    The whole command line argument (or the value part of `--key=value`).
+ * \param[out] value The value to parse into.
+ * \returns A std::from_chars_result like std::from_chars: `ec` is `std::errc{}` on success,
+ *          `std::errc::invalid_argument` or `std::errc::result_out_of_range` otherwise, and `ptr` points behind the
+ *          last parsed character.
+ * \ingroup parser
+ * \details
+ *
+ * This is a function object. Invoke it with the parameter(s) specified above.
+ *
+ * By default, the sharg::parser reads values of custom types with the stream `operator>>` (see sharg::istreamable),
+ * which constructs a std::istringstream for every value. Types that provide this customisation point are parsed
+ * directly from the argument instead. Parsing fails unless `ptr` is `in.data() + in.size()`, i.e. the whole argument
+ * must be consumed.
+ *
+ * It acts as a wrapper and looks for two possible implementations (in this order):
+ *
+ *   1. A static member function `from_chars(std::string_view, your_type &)` in `sharg::custom::parsing<your_type>`.
+ *   2. A free function `from_chars(std::string_view, your_type &)` in the namespace of your type (or as `friend`).
+ *
+ * Both must return a std::from_chars_result.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * namespace foo
+ * {
+ * struct point
+ * {
+ *     int x;
+ *     int y;
+ *
+ *     // "3,4"
+ *     friend std::from_chars_result from_chars(std::string_view const in, point & p)
+ *     {
+ *         char const * const end = in.data() + in.size();
+ *         std::from_chars_result res = std::from_chars(in.data(), end, p.x);
+ *
+ *         if (res.ec != std::errc{} || res.ptr == end || *res.ptr != ',')
+ *             return {res.ptr, std::errc::invalid_argument};
+ *
+ *         return std::from_chars(res.ptr + 1, end, p.y);
+ *     }
+ *
+ *     friend std::ostream & operator<<(std::ostream & stream, point const & p)
+ *     {
+ *         return stream << p.x << ',' << p.y;
+ *     }
+ * };
+ * } // namespace foo
+ * ```
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * ### Customisation point
+ *
+ * This is a customisation point (see \ref about_customisation). To specify the behaviour for your type,
+ * simply provide one of the two functions specified above.
+ */
+inline constexpr auto from_chars = detail::adl_only::from_chars_cpo{};
+//!\}
+
+/*!\concept sharg::from_chars_parsable
+ * \brief Checks whether sharg::from_chars can be called on the type.
+ * \ingroup parser
+ * \tparam option_type The type to check.
+ *
+ * ### Requirements
+ *
+ * sharg::from_chars must be callable with a std::string_view and an l-value of `option_type` and return a
+ * std::from_chars_result.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+template <typename option_type>
+concept from_chars_parsable = requires (std::string_view const in, option_type & value)
+{
+    { sharg::from_chars(in, value) } -> std::same_as<std::from_chars_result>;
+};
+
+} // namespace sharg
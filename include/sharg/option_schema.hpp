@@ -0,0 +1,411 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::option_schema.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <string_view>
+
+#include <sharg/detail/char_class.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg
+{
+
+/*!\brief The short and long identifier of an option or flag in a sharg::option_schema.
+ * \ingroup parser
+ */
+struct option_identifier
+{
+    //!\brief The short identifier, e.g. 'i' (`'\0'` if not set).
+    char short_id{'\0'};
+    //!\brief The long identifier without leading dashes, e.g. "input" (empty if not set).
+    std::string_view long_id{};
+};
+
+} // namespace sharg
+
+namespace sharg::detail
+{
+
+/*!\brief A non-owning, type-erased view of a sharg::option_schema.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The view refers to the identifiers and the hash table of a sharg::option_schema, which must outlive the view.
+ * Long identifiers are looked up via a perfect hash: the hash of a declared long identifier never collides with the
+ * one of another declared long identifier, so a lookup computes one hash and compares at most one string.
+ *
+ * The perfect hash is built by "hash and displace": the hash of an identifier selects a bucket and the displacement
+ * of the bucket selects the slot, see slot_of(). Each bucket holds a few identifiers on average, so a displacement
+ * without collisions is found quickly for every bucket, also for schemas with hundreds of options.
+ */
+class option_schema_view
+{
+public:
+    //!\brief Returned by the find functions if the identifier is not part of the schema.
+    static constexpr size_t npos{static_cast<size_t>(-1)};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr option_schema_view() = default;                                       //!< Defaulted.
+    constexpr option_schema_view(option_schema_view const &) = default;             //!< Defaulted.
+    constexpr option_schema_view & operator=(option_schema_view const &) = default; //!< Defaulted.
+    constexpr option_schema_view(option_schema_view &&) = default;                  //!< Defaulted.
+    constexpr option_schema_view & operator=(option_schema_view &&) = default;      //!< Defaulted.
+    ~option_schema_view() = default;                                                //!< Defaulted.
+
+    /*!\brief Constructs the view from its parts.
+     * \param[in] ids           The identifiers of the schema.
+     * \param[in] slots         The hash table, storing the index of an identifier + 1 (0 denotes an empty slot).
+     * \param[in] displacements The displacement of each bucket, for which `slots` is collision free.
+     */
+    constexpr option_schema_view(std::span<option_identifier const> ids,
+                                 std::span<uint16_t const> slots,
+                                 std::span<uint16_t const> displacements) :
+        ids{ids}, slots{slots}, displacements{displacements}
+    {}
+    //!\}
+
+    //!\brief Returns the declared identifiers.
+    constexpr std::span<option_identifier const> identifiers() const noexcept
+    {
+        return ids;
+    }
+
+    //!\brief Returns the index of `long_id` in identifiers() or npos.
+    constexpr size_t find_long_id(std::string_view const long_id) const noexcept
+    {
+        if (long_id.empty() || slots.empty())
+            return npos;
+
+        uint64_t const h = hash(long_id);
+        uint16_t const slot = slots[slot_of(h, displacements[bucket_of(h, displacements.size())], slots.size())];
+
+        if (slot == 0 || ids[slot - 1].long_id != long_id)
+            return npos;
+
+        return slot - 1;
+    }
+
+    //!\brief Returns the index of `short_id` in identifiers() or npos.
+    constexpr size_t find_short_id(char const short_id) const noexcept
+    {
+        if (short_id == '\0')
+            return npos;
+
+        for (size_t i = 0; i < ids.size(); ++i)
+            if (ids[i].short_id == short_id)
+                return i;
+
+        return npos;
+    }
+
+    //!\brief The hash function of the schema (FNV-1a).
+    static constexpr uint64_t hash(std::string_view const str) noexcept
+    {
+        uint64_t h{14695981039346656037ULL};
+
+        for (char const c : str)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ULL;
+        }
+
+        return h ^ (h >> 32);
+    }
+
+    /*!\brief The bucket of hash `h`.
+     * \param[in] h            The hash of a long identifier.
+     * \param[in] bucket_count The number of buckets (a power of two).
+     */
+    static constexpr size_t bucket_of(uint64_t const h, size_t const bucket_count) noexcept
+    {
+        return static_cast<size_t>((h * 0x9E3779B97F4A7C15ULL) >> 40) & (bucket_count - 1);
+    }
+
+    /*!\brief The slot of hash `h` for the displacement of its bucket.
+     * \param[in] h            The hash of a long identifier.
+     * \param[in] displacement The displacement of the bucket of `h`.
+     * \param[in] table_size   The size of the hash table (a power of two).
+     *
+     * \details
+     *
+     * The step is odd, so the displacements 0, 1, ..., `table_size - 1` lead to different slots for the same hash.
+     */
+    static constexpr size_t slot_of(uint64_t const h, uint16_t const displacement, size_t const table_size) noexcept
+    {
+        uint64_t const step = (h >> 24) | 1;
+        return static_cast<size_t>(h + displacement * step) & (table_size - 1);
+    }
+
+private:
+    //!\brief The identifiers of the schema.
+    std::span<option_identifier const> ids{};
+    //!\brief The perfect hash table.
+    std::span<uint16_t const> slots{};
+    //!\brief The displacement of each bucket.
+    std::span<uint16_t const> displacements{};
+};
+
+} // namespace sharg::detail
+
+namespace sharg
+{
+
+/*!\brief A compile-time declaration of all option and flag identifiers of a sharg::parser.
+ * \ingroup parser
+ * \tparam size The number of declared identifiers.
+ *
+ * \details
+ *
+ * If an application has a fixed set of options, the identifiers can be declared up front in a `constexpr` schema.
+ * All checks that sharg::parser otherwise performs when calling sharg::parser::add_option or
+ * sharg::parser::add_flag are done at compile time: empty, malformed, reserved or duplicate identifiers make the
+ * program ill-formed. In addition, a perfect hash for the long identifiers is generated at compile time and used
+ * to look up long identifiers while parsing.
+ *
+ * The schema is passed to the constructor of sharg::parser and must outlive it, so it should be declared
+ * `static constexpr`. Every option and flag added to such a parser must be declared in the schema, with exactly
+ * the same short and long identifier.
+ *
+ * ```cpp
+ * static constexpr sharg::option_schema schema{sharg::option_identifier{'i', "input"},
+ *                                              sharg::option_identifier{'\0', "verbose"}};
+ *
+ * sharg::parser parser{"my_app", argc, argv, schema};
+ * parser.add_option(input, 'i', "input", "The input file.");
+ * parser.add_flag(verbose, '\0', "verbose", "Print more information.");
+ * ```
+ */
+template <size_t size>
+class option_schema
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr option_schema(option_schema const &) = default;             //!< Defaulted.
+    constexpr option_schema & operator=(option_schema const &) = default; //!< Defaulted.
+    constexpr option_schema(option_schema &&) = default;                  //!< Defaulted.
+    constexpr option_schema & operator=(option_schema &&) = default;      //!< Defaulted.
+    ~option_schema() = default;                                           //!< Defaulted.
+
+    /*!\brief Declares the identifiers, verifies them and generates the perfect hash (at compile time).
+     * \param[in] identifiers The short and long identifiers of all options and flags.
+     *
+     * \details
+     *
+     * The same rules as for sharg::parser::add_option apply. Identifiers that violate them are reported as a
+     * compile-time error pointing to the respective check.
+     */
+    template <std::same_as<option_identifier> ...identifier_types>
+    //!\cond
+        requires (sizeof...(identifier_types) == size)
+    //!\endcond
+    consteval option_schema(identifier_types const ... identifiers) : ids{identifiers...}
+    {
+        verify();
+        generate_perfect_hash();
+    }
+    //!\}
+
+    //!\brief Returns a type-erased view of the schema.
+    constexpr detail::option_schema_view view() const noexcept
+    {
+        return {ids, slots, displacements};
+    }
+
+    //!\brief Returns the declared identifiers.
+    constexpr std::array<option_identifier, size> const & identifiers() const noexcept
+    {
+        return ids;
+    }
+
+    //!\brief Returns the index of `long_id` in identifiers() or sharg::detail::option_schema_view::npos.
+    constexpr size_t find_long_id(std::string_view const long_id) const noexcept
+    {
+        return view().find_long_id(long_id);
+    }
+
+private:
+    //!\brief The size of the hash table (a power of two with a load factor of at most 0.5).
+    static constexpr size_t table_size{std::bit_ceil(size * 2 == 0 ? size_t{1} : size * 2)};
+    //!\brief The number of buckets (a power of two with about four identifiers per bucket).
+    static constexpr size_t bucket_count{std::bit_ceil(size / 4 == 0 ? size_t{1} : size / 4)};
+
+    static_assert(size < 0xFFFF, "An option schema can hold at most 65534 identifiers.");
+
+    //!\brief Whether `long_id` is reserved by the parser.
+    static constexpr bool is_reserved(std::string_view const long_id) noexcept
+    {
+        for (std::string_view const reserved : {"hh", "help", "advanced-help", "export-help", "version", "copyright"})
+            if (long_id == reserved)
+                return true;
+
+        return false;
+    }
+
+    //!\brief Checks all identifiers. A failing check is not a constant expression and thus a compile-time error.
+    consteval void verify() const
+    {
+        std::array<bool, 256> short_id_used{};
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            option_identifier const & id = ids[i];
+
+            if (id.short_id == '\0' && id.long_id.empty())
+                throw design_error{"Option Identifiers cannot both be empty."};
+            if (id.long_id.size() == 1)
+                throw design_error{"Long IDs must be either empty, or longer than one character."};
+            if (id.short_id != '\0' && !detail::is_char_of(id.short_id, detail::short_id_chars))
+                throw design_error{"Option identifiers may only contain alphanumeric characters, '_', or '@'."};
+            if (!id.long_id.empty() && id.long_id[0] == '-')
+                throw design_error{"First character of long ID cannot be '-'."};
+
+            if (!id.long_id.empty() && !detail::consists_of(id.long_id, detail::long_id_chars))
+                throw design_error{"Long identifiers may only contain alphanumeric characters, '_', '-', or '@'."};
+
+            if (id.short_id == 'h' || is_reserved(id.long_id))
+                throw design_error{"Option Identifier is reserved by the parser."};
+
+            if (id.short_id != '\0')
+            {
+                bool & used = short_id_used[static_cast<unsigned char>(id.short_id)];
+
+                if (used)
+                    throw design_error{"Short option identifier was already used before."};
+
+                used = true;
+            }
+        }
+        // duplicate long identifiers have the same hash and are detected in generate_perfect_hash
+    }
+
+    /*!\brief Searches a displacement for each bucket such that the long identifiers are hashed without collisions.
+     *
+     * \details
+     *
+     * The identifiers are sorted by bucket (counting sort) and the buckets are placed from the largest to the
+     * smallest. For each bucket, the displacements are tried in order until all identifiers of the bucket hit
+     * different empty slots. Compile time grows linearly with the number of identifiers.
+     */
+    consteval void generate_perfect_hash()
+    {
+        using view_t = detail::option_schema_view;
+
+        std::array<uint64_t, size> hashes{};
+        std::array<size_t, bucket_count + 1> bucket_begin{}; // the members of bucket b are order[bucket_begin[b]...]
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (!ids[i].long_id.empty())
+            {
+                hashes[i] = view_t::hash(ids[i].long_id);
+                ++bucket_begin[view_t::bucket_of(hashes[i], bucket_count) + 1];
+            }
+        }
+
+        size_t largest_bucket{0};
+
+        for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+        {
+            largest_bucket = std::max(largest_bucket, bucket_begin[bucket + 1]);
+            bucket_begin[bucket + 1] += bucket_begin[bucket];
+        }
+
+        std::array<size_t, size> order{};
+        std::array<size_t, bucket_count + 1> bucket_end{bucket_begin};
+
+        for (size_t i = 0; i < size; ++i)
+            if (!ids[i].long_id.empty())
+                order[bucket_end[view_t::bucket_of(hashes[i], bucket_count)]++] = i;
+
+        for (size_t bucket_size = largest_bucket; bucket_size > 0; --bucket_size)
+        {
+            for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+            {
+                if (bucket_begin[bucket + 1] - bucket_begin[bucket] != bucket_size)
+                    continue;
+
+                std::span<size_t const> const members{order.data() + bucket_begin[bucket], bucket_size};
+                displacements[bucket] = find_displacement(hashes, members);
+
+                for (size_t const member : members)
+                {
+                    size_t const slot = view_t::slot_of(hashes[member], displacements[bucket], table_size);
+                    slots[slot] = static_cast<uint16_t>(member + 1);
+                }
+            }
+        }
+    }
+
+    //!\brief Returns the first displacement for which the `members` of a bucket hit different empty slots.
+    consteval uint16_t find_displacement(std::array<uint64_t, size> const & hashes,
+                                         std::span<size_t const> const members) const
+    {
+        for (size_t m = 0; m < members.size(); ++m)
+            for (size_t previous = 0; previous < m; ++previous)
+                if (ids[members[previous]].long_id == ids[members[m]].long_id)
+                    throw design_error{"Long option identifier was already used before."};
+
+        for (size_t displacement = 0; displacement < std::min<size_t>(table_size, 0x10000); ++displacement)
+        {
+            bool collision_free{true};
+
+            for (size_t m = 0; m < members.size() && collision_free; ++m)
+            {
+                size_t const slot = detail::option_schema_view::slot_of(hashes[members[m]],
+                                                                        static_cast<uint16_t>(displacement),
+                                                                        table_size);
+                collision_free = (slots[slot] == 0);
+
+                for (size_t previous = 0; previous < m && collision_free; ++previous)
+                {
+                    collision_free = (slot != detail::option_schema_view::slot_of(hashes[members[previous]],
+                                                                                  static_cast<uint16_t>(displacement),
+                                                                                  table_size));
+                }
+            }
+
+            if (collision_free)
+                return static_cast<uint16_t>(displacement);
+        }
+
+        throw design_error{"Could not generate a perfect hash for the long identifiers."};
+    }
+
+    //!\brief The declared identifiers.
+    std::array<option_identifier, size> ids{};
+    //!\brief The perfect hash table, storing the index of an identifier + 1 (0 denotes an empty slot).
+    std::array<uint16_t, table_size> slots{};
+    //!\brief The displacement of each bucket, for which `slots` is collision free.
+    std::array<uint16_t, bucket_count> displacements{};
+};
+
+/*!\name Type deduction guides
+ * \{
+ */
+//!\brief Deduces the size from the number of identifiers.
+template <typename ...identifier_types>
+option_schema(identifier_types ...) -> option_schema<sizeof...(identifier_types)>;
+//!\}
+
+} // namespace sharg
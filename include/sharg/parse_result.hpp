@@ -0,0 +1,160 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::parse_result.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <sharg/detail/small_function.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg
+{
+
+/*!\brief The kind of error that occurred while parsing the command line.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Each kind corresponds to the exception that sharg::parser::parse throws for it.
+ */
+enum class parse_error_kind : uint8_t
+{
+    none,                           //!< No error occurred.
+    unknown_option,                 //!< See sharg::unknown_option.
+    too_many_arguments,             //!< See sharg::too_many_arguments.
+    too_few_arguments,              //!< See sharg::too_few_arguments.
+    required_option_missing,        //!< See sharg::required_option_missing.
+    option_declared_multiple_times, //!< See sharg::option_declared_multiple_times.
+    user_input_error,               //!< See sharg::user_input_error.
+    validation_error                //!< See sharg::validation_error.
+};
+
+/*!\brief The result of sharg::parser::try_parse.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * On failure, the result describes the first error that was encountered: its kind, the index of the offending
+ * argument and the identifier of the option it belongs to. The human readable message is only formatted when
+ * calling message(), such that rejecting a command line does not cost more than detecting the error.
+ *
+ * The result may refer to the command line arguments, i.e. `argv` must outlive it.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class parse_result
+{
+public:
+    //!\brief The type of the function that formats the message.
+    using formatter_type = detail::small_function<std::string(parse_result const &)>;
+
+    //!\brief The value of argument_index() if the error does not refer to a single argument.
+    static constexpr size_t npos{static_cast<size_t>(-1)};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parse_result() = default;                                 //!< Defaulted (success).
+    parse_result(parse_result const &) = default;             //!< Defaulted.
+    parse_result & operator=(parse_result const &) = default; //!< Defaulted.
+    parse_result(parse_result &&) = default;                  //!< Defaulted.
+    parse_result & operator=(parse_result &&) = default;      //!< Defaulted.
+    ~parse_result() = default;                                //!< Defaulted.
+
+    /*!\brief Constructs a failed result.
+     * \param[in] kind           The kind of the error.
+     * \param[in] argument_index The index of the offending argument in `argv` or npos.
+     * \param[in] option_id      The identifier of the offending option (e.g. `-i/--int`), if any.
+     * \param[in] formatter      Formats the message when calling message().
+     */
+    parse_result(parse_error_kind const kind,
+                 size_t const argument_index,
+                 std::string option_id,
+                 formatter_type formatter) :
+        error_kind{kind},
+        index{argument_index},
+        id{std::move(option_id)},
+        format{std::move(formatter)}
+    {}
+    //!\}
+
+    //!\brief Returns `true` if the command line was parsed successfully.
+    bool success() const noexcept
+    {
+        return error_kind == parse_error_kind::none;
+    }
+
+    //!\brief Returns `true` if the command line was parsed successfully.
+    explicit operator bool() const noexcept
+    {
+        return success();
+    }
+
+    //!\brief The kind of the error (sharg::parse_error_kind::none on success).
+    parse_error_kind kind() const noexcept
+    {
+        return error_kind;
+    }
+
+    /*!\brief The index of the offending argument in `argv` (0 is the program name).
+     * \details Returns npos on success and if the error does not refer to a single argument, e.g. if a required
+     *          option is missing.
+     */
+    size_t argument_index() const noexcept
+    {
+        return index;
+    }
+
+    //!\brief The identifier of the offending option, e.g. `-i/--int`, or an empty string.
+    std::string_view option_id() const noexcept
+    {
+        return id;
+    }
+
+    //!\brief Formats the error message; this is the message of the exception thrown by sharg::parser::parse.
+    std::string message() const
+    {
+        return format ? format(*this) : std::string{};
+    }
+
+    /*!\brief Throws the exception corresponding to kind().
+     * \throws sharg::parser_error (the derived type depends on kind()) if this is not a successful result.
+     */
+    void throw_if_failed() const
+    {
+        switch (error_kind)
+        {
+            case parse_error_kind::none:                           return;
+            case parse_error_kind::unknown_option:                 throw unknown_option{message()};
+            case parse_error_kind::too_many_arguments:             throw too_many_arguments{message()};
+            case parse_error_kind::too_few_arguments:              throw too_few_arguments{message()};
+            case parse_error_kind::required_option_missing:        throw required_option_missing{message()};
+            case parse_error_kind::option_declared_multiple_times: throw option_declared_multiple_times{message()};
+            case parse_error_kind::user_input_error:               throw user_input_error{message()};
+            case parse_error_kind::validation_error:               throw validation_error{message()};
+        }
+    }
+
+private:
+    //!\brief The kind of the error.
+    parse_error_kind error_kind{parse_error_kind::none};
+    //!\brief The index of the offending argument.
+    size_t index{npos};
+    //!\brief The identifier of the offending option.
+    std::string id{};
+    //!\brief Formats the message.
+    formatter_type format{};
+};
+
+} // namespace sharg
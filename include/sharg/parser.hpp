@@ -12,14 +12,19 @@
 
 #pragma once
 
+#include <optional>
 #include <set>
 #include <variant>
 
+#include <sharg/detail/char_class.hpp>
 #include <sharg/detail/format_help.hpp>
 #include <sharg/detail/format_html.hpp>
 #include <sharg/detail/format_man.hpp>
 #include <sharg/detail/format_parse.hpp>
+#include <sharg/detail/response_file.hpp>
+#include <sharg/detail/special_arguments.hpp>
 #include <sharg/detail/version_check.hpp>
+#include <sharg/option_schema.hpp>
 
 namespace sharg
 {
@@ -177,6 +182,16 @@ public:
      *
      * See the [parser tutorial](https://docs.seqan.de/seqan/3-master-dev/tutorial_parser.html)
      * for more information about the version check functionality.
+     *
+     * The command line arguments are not copied. The parser (and any sub-parser) only refers to the strings in `argv`,
+     * which therefore must outlive the parser. This is always the case for the arguments passed to `main()`.
+     *
+     * An argument `@path` is replaced by the arguments in the file `path` (a response file), which are separated by
+     * white space and may be quoted like in a POSIX shell. Response files may refer to other response files.
+     * If `path` cannot be opened, the argument is kept as it is; if it is not a regular file (e.g. `/dev/stdin`), the
+     * constructor throws. Arguments after `--` are not expanded. The files are memory mapped and not copied.
+     * Subcommands must be given directly on the command line, not in a response file. If a response file is used,
+     * sharg::parse_result::argument_index refers to the position in the expanded command line.
      */
     parser(std::string const app_name,
            int const argc,
@@ -186,7 +201,7 @@ public:
         version_check_dev_decision{version_updates},
         subcommands{std::move(subcommands)}
     {
-        if (!std::regex_match(app_name, app_name_regex))
+        if (!detail::is_valid_app_name(app_name))
         {
             throw design_error{("The application name must only contain alpha-numeric characters or '_' and '-' "
                                 "(regex: \"^[a-zA-Z0-9_-]+$\").")};
@@ -194,7 +209,7 @@ public:
 
         for (auto & sub : this->subcommands)
         {
-            if (!std::regex_match(sub, app_name_regex))
+            if (!detail::is_valid_app_name(sub))
             {
                 throw design_error{"The subcommand name must only contain alpha-numeric characters or '_' and '-' "
                                    "(regex: \"^[a-zA-Z0-9_-]+$\")."};
@@ -206,6 +221,49 @@ public:
         init(argc, argv);
     }
 
+    /*!\brief Initializes an sharg::parser object with a compile-time declared sharg::option_schema.
+     *
+     * \param[in] app_name The name of the app that is displayed on the help page.
+     * \param[in] argc The number of command line arguments.
+     * \param[in] argv The command line arguments to parse.
+     * \param[in] schema The identifiers of all options and flags; must outlive the parser.
+     * \param[in] version_updates Notify users about version updates (default sharg::update_notifications::on).
+     * \param[in] subcommands A list of subcommands (see \link subcommand_parse subcommand parsing \endlink).
+     *
+     * \throws sharg::design_error if the application name contains illegal characters.
+     *
+     * \details
+     *
+     * The identifiers of the schema are verified at compile time. Every option and flag that is added afterwards
+     * must be declared in the schema. Instead of verifying the identifiers again, sharg::parser::add_option and
+     * sharg::parser::add_flag only look them up in the schema. Long identifiers on the command line are looked up
+     * via the perfect hash of the schema.
+     */
+    template <size_t schema_size>
+    parser(std::string const app_name,
+           int const argc,
+           char const * const * const argv,
+           option_schema<schema_size> const & schema,
+           update_notifications version_updates = update_notifications::on,
+           std::vector<std::string> subcommands = {}) :
+        parser{std::move(app_name), argc, argv, version_updates, std::move(subcommands)}
+    {
+        option_schema_ids = schema.view();
+        registered_schema_ids.assign(schema_size, false);
+
+        if (auto * parse_format = std::get_if<detail::format_parse>(&format); parse_format != nullptr)
+            parse_format->set_option_schema(*option_schema_ids);
+    }
+
+    //!\brief The schema must outlive the parser, so temporaries are not allowed.
+    template <size_t schema_size>
+    parser(std::string const app_name,
+           int const argc,
+           char const * const * const argv,
+           option_schema<schema_size> const && schema,
+           update_notifications version_updates = update_notifications::on,
+           std::vector<std::string> subcommands = {}) = delete;
+
     //!\brief The destructor.
     ~parser()
     {
@@ -256,12 +314,78 @@ public:
             throw design_error{"You may only specify flags for the top-level parser."};
 
         verify_identifiers(short_id, long_id);
+
+        if constexpr (detail::is_container_option<option_type>)
+        {
+            if (short_id != '\0')
+                list_option_ids.insert(std::string{short_id});
+            if (!long_id.empty())
+                list_option_ids.insert(long_id);
+        }
+
         // copy variables into the lambda because the calls are pushed to a stack
         // and the references would go out of scope.
         std::visit([=, &value] (auto & f) { f.add_option(value, short_id, long_id, desc, spec, option_validator); },
                    format);
     }
 
+    /*!\brief Allows the user to give several values of a list option in a single argument.
+     * \tparam id_type Either type `char` or a type that a `std::string` is constructible from.
+     * \param[in] id        The short (`char`) or long (`std::string`) identifier of the option.
+     * \param[in] delimiter The character that separates the values, e.g. `','`.
+     * \throws sharg::design_error if the function is used incorrectly (see details below).
+     *
+     * \details
+     *
+     * By default, each value of a list option is given with its own identifier, e.g. `-i 1 -i 2 -i 3`. After setting
+     * the delimiter `','`, the user may also write `-i 1,2,3` or `--ids=1,2,3`. Both forms can be combined; the values
+     * are appended in the order they are given. A delimiter cannot occur inside a value, e.g. a list of paths with
+     * the delimiter `','` cannot contain a path with a comma.
+     *
+     * Large lists are parsed in one pass over a single argument instead of one identifier per value.
+     *
+     * ### Example
+     *
+     * ```cpp
+     * std::vector<int> ids{};
+     * parser.add_option(ids, 'i', "ids", "The ids.");
+     * parser.set_list_delimiter('i', ',');
+     * ```
+     *
+     * ### Exceptions
+     *
+     * This function throws a sharg::design_error if
+     * * `sharg::parser::parse()` was already called.
+     * * the delimiter is `'\0'`.
+     * * the identifier was not added to the parser via `sharg::parser::add_option()` beforehand or the option is no
+     *   list/container.
+     */
+    template <typename id_type>
+    //!\cond
+        requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
+    //!\endcond
+    void set_list_delimiter(id_type const & id, char const delimiter)
+    {
+        if (parse_was_called)
+            throw design_error{"The list delimiter of an option must be set before calling `parse()`."};
+
+        if (delimiter == '\0')
+            throw design_error{"The list delimiter cannot be '\\0'."};
+
+        using char_or_string_t = std::conditional_t<std::same_as<id_type, char>, char, std::string>;
+        char_or_string_t short_or_long_id = {id}; // e.g. convert char * to string here if necessary
+
+        if (!list_option_ids.contains(std::string({short_or_long_id})))
+            throw design_error{"You can only set a list delimiter for list options that you added with add_option() "
+                               "before."};
+
+        std::visit([&] (auto & f)
+        {
+            if constexpr (std::same_as<std::remove_cvref_t<decltype(f)>, detail::format_parse>)
+                f.set_list_delimiter(short_or_long_id, delimiter);
+        }, format);
+    }
+
     /*!\brief Adds a flag to the sharg::parser.
      *
      * \param[in, out] value     The variable which shows if the flag is turned off (default) or on.
@@ -333,6 +457,67 @@ public:
         // and the references would go out of scope.
         std::visit([=, &value] (auto & f) { f.add_positional_option(value, desc, option_validator); }, format);
     }
+
+    /*!\brief Adds a positional list option to the sharg::parser that hands over each value as soon as it is parsed.
+     *
+     * \tparam value_type The type of a single value (must be given explicitly). Must satisfy the same requirements
+     *                    as `option_type` in the overload above.
+     * \tparam sink_type Either a callable that takes a `value_type` rvalue or an output iterator for `value_type`.
+     * \tparam validator_type The type of validator to be applied to each value. Must model sharg::validator.
+     *
+     * \param[in] sink Receives the values (it is copied).
+     * \param[in] desc The description of the positional option to be shown in the help page.
+     * \param[in] option_validator A sharg::validator that verifies each value after parsing (callable).
+     *
+     * \throws sharg::design_error
+     *
+     * \details
+     *
+     * Like a positional option of type `std::vector<value_type>`, this consumes all remaining arguments and must be
+     * the last positional option. Instead of filling a container, every value is parsed, validated and handed over to
+     * `sink` one after another, so nothing is retained by the parser. Note that the validator is called for each
+     * value, not for the whole list. If a value is invalid, sharg::parser::parse throws, but the values before it
+     * have already been handed over. Unlike a container, a sink may receive no value at all: if no arguments remain,
+     * the sink is not called and parsing succeeds.
+     *
+     * ```cpp
+     * size_t number_of_files{};
+     * parser.add_positional_option<std::filesystem::path>([&] (std::filesystem::path && file)
+     * {
+     *     ++number_of_files;
+     * }, "The input files.", sharg::input_file_validator{});
+     * ```
+     */
+    template <typename value_type, typename sink_type, validator validator_type = detail::default_validator>
+    //!\cond
+        requires parser_compatible_option<value_type> &&
+                 (std::invocable<sink_type &, value_type> || std::output_iterator<sink_type, value_type>) &&
+                 std::invocable<validator_type, value_type>
+    //!\endcond
+    void add_positional_option(sink_type sink,
+                               std::string const & desc,
+                               validator_type option_validator = validator_type{}) // copy to bind rvalues
+    {
+        if (sub_parser != nullptr)
+            throw design_error{"You may only specify flags for the top-level parser."};
+
+        if (has_positional_list_option)
+            throw design_error{"You added a positional option with a list value before so you cannot add "
+                                      "any other positional options."};
+
+        has_positional_list_option = true; // a sink consumes all remaining arguments like a list
+
+        auto sink_function = [&sink] ()
+        {
+            if constexpr (std::invocable<sink_type &, value_type>)
+                return std::move(sink);
+            else // an output iterator
+                return [it = std::move(sink)] (value_type && value) mutable { *it = std::move(value); ++it; };
+        }();
+
+        std::visit([&] (auto & f) { f.template add_positional_sink<value_type>(sink_function, desc, option_validator); },
+                   format);
+    }
     //!\}
 
     /*!\brief Initiates the actual command line parsing.
@@ -399,8 +584,32 @@ public:
      * The Age App - [PARSER ERROR] Value cast failed for option -a: Argument abc
      *                              could not be casted to type (signed 32 bit integer).
      * ```
+     *
+     * This function throws the exception that corresponds to the result of sharg::parser::try_parse.
      */
     void parse()
+    {
+        try_parse().throw_if_failed();
+    }
+
+    /*!\brief Initiates the actual command line parsing without throwing on invalid user input.
+     *
+     * \returns A sharg::parse_result that describes the first error or a successful result.
+     *
+     * \throws sharg::design_error if this function (or sharg::parser::parse) was already called before.
+     *
+     * \details
+     *
+     * This function behaves exactly like sharg::parser::parse, including the special keywords like `--help`,
+     * but instead of throwing an exception on invalid user input, it returns a sharg::parse_result. The result
+     * holds the kind of the error, the index of the offending argument in `argv` and the offending option identifier.
+     * The message is only formatted when calling sharg::parse_result::message. Errors of the developer,
+     * i.e. sharg::design_error, are still thrown. If a validator throws, the exception is caught and returned as
+     * sharg::parse_error_kind::validation_error.
+     *
+     * This is useful if many command lines need to be checked and invalid ones are not exceptional.
+     */
+    parse_result try_parse()
     {
         if (parse_was_called)
             throw design_error("The function parse() must only be called once!");
@@ -410,14 +619,18 @@ public:
         if (std::holds_alternative<detail::format_parse>(format) && !subcommands.empty() && sub_parser == nullptr)
         {
             assert(!subcommands.empty());
-            std::string subcommands_str{"["};
-            for (std::string const & command : subcommands)
-                subcommands_str += command + ", ";
-            subcommands_str.replace(subcommands_str.size() - 2, 2, "]"); // replace last ", " by "]"
-
-            throw too_few_arguments{"You either forgot or misspelled the subcommand! Please specify which sub-program "
-                                    "you want to use: one of " + subcommands_str + ". Use -h/--help for more "
-                                    "information."};
+
+            return parse_result{parse_error_kind::too_few_arguments, parse_result::npos, {},
+                                [commands = subcommands] (parse_result const &)
+            {
+                std::string subcommands_str{"["};
+                for (std::string const & command : commands)
+                    subcommands_str += command + ", ";
+                subcommands_str.replace(subcommands_str.size() - 2, 2, "]"); // replace last ", " by "]"
+
+                return "You either forgot or misspelled the subcommand! Please specify which sub-program "
+                       "you want to use: one of " + subcommands_str + ". Use -h/--help for more information.";
+            }};
         }
 
         if (app_version.decide_if_check_is_performed(version_check_dev_decision, version_check_user_decision))
@@ -429,7 +642,15 @@ public:
         }
 
         std::visit([this] (auto & f) { f.parse(info); }, format);
+
+        if (auto * parse_format = std::get_if<detail::format_parse>(&format); parse_format != nullptr)
+        {
+            if (!parse_format->result())
+                return parse_format->result();
+        }
+
         parse_was_called = true;
+        return {};
     }
 
     //!\brief Returns a reference to the sub-parser instance if
@@ -493,7 +714,7 @@ public:
             }
         }
 
-        if (std::find(used_option_ids.begin(), used_option_ids.end(), std::string{id}) == used_option_ids.end())
+        if (!id_was_added(short_or_long_id))
             throw design_error{"You can only ask for option identifiers that you added with add_option() before."};
 
         // we only need to search for an option before the `end_of_options_indentifier` (`--`)
@@ -633,12 +854,12 @@ private:
     //!\brief Befriend sharg::detail::test_accessor to grant access to version_check_future and format.
     friend struct ::sharg::detail::test_accessor;
 
+    //!\brief Befriend sharg::parser_schema, which uses the format_parse of a parser as prototype.
+    friend class parser_schema;
+
     //!\brief The future object that keeps track of the detached version check call thread.
     std::future<bool> version_check_future;
 
-    //!\brief Validates the application name to ensure an escaped server call.
-    std::regex app_name_regex{"^[a-zA-Z0-9_-]+$"};
-
     //!\brief Signals the parser that no options follow this string but only positional arguments.
     static constexpr std::string_view const end_of_options_indentifier{"--"};
 
@@ -664,11 +885,23 @@ private:
                  detail::format_copyright/*,
                  detail::format_ctd*/> format{detail::format_help{{}, false}}; // Will be overwritten in any case.
 
+    //!\brief The identifiers of options whose type is a list/container, see sharg::parser::set_list_delimiter.
+    std::set<std::string> list_option_ids{};
+
     //!\brief List of option/flag identifiers that are already used.
     std::set<std::string> used_option_ids{"h", "hh", "help", "advanced-help", "export-help", "version", "copyright"};
 
-    //!\brief The command line arguments.
-    std::vector<std::string> cmd_arguments{};
+    //!\brief The declared identifiers if the parser was constructed with a sharg::option_schema.
+    std::optional<detail::option_schema_view> option_schema_ids{};
+
+    //!\brief Whether the identifier with the respective index in option_schema_ids was already added.
+    std::vector<bool> registered_schema_ids{};
+
+    //!\brief The command line arguments (views into `argv` or into response files).
+    std::vector<std::string_view> cmd_arguments{};
+
+    //!\brief Owns the response files that were expanded in parser::init.
+    detail::response_file_expander response_files{};
 
     /*!\brief Initializes the sharg::parser class on construction.
      *
@@ -680,10 +913,14 @@ private:
      * \throws sharg::validation_error if the value passed to option --export-help was invalid.
      * \throws sharg::validation_error if the value passed to option --version-check was invalid.
      * \throws sharg::too_few_arguments if a sub parser was configured at construction but a subcommand is missing.
+     * \throws sharg::user_input_error if a response file is not a regular file, refers to itself or contains an
+     *         unterminated quote.
      *
      * \details
      *
-     * This function adds all command line parameters to the cmd_arguments member variable
+     * First, response files (`@file`) are expanded, see sharg::detail::response_file_expander. The special arguments
+     * are found by sharg::detail::scan_special_arguments, which sharg::parser_schema uses as well.
+     * This function adds views of all command line parameters to the cmd_arguments member variable
      * to take advantage of the vector functionality later on. Additionally,
      * the format member variable is set, depending on which parameters are given
      * by the user:
@@ -710,97 +947,67 @@ private:
             return;
         }
 
-        bool special_format_was_set{false};
-
+        std::vector<std::string_view> arguments{}; // the arguments with response files expanded
+        arguments.reserve(argc);
 
-        for (int i = 1, argv_len = argc; i < argv_len; ++i) // start at 1 to skip binary name
+        for (int i = 1; i < argc; ++i) // start at 1 to skip binary name
         {
-            std::string arg{argv[i]};
+            std::string_view const arg{argv[i]};
 
             if (std::find(subcommands.begin(), subcommands.end(), arg) != subcommands.end())
             {
-                sub_parser = std::make_unique<parser>(info.app_name + "-" + arg,
+                sub_parser = std::make_unique<parser>(info.app_name + "-" + std::string{arg},
                                                       argc - i,
                                                       argv + i,
                                                       update_notifications::off);
                 break;
             }
 
-            if (arg == "-h" || arg == "--help")
-            {
+            response_files.expand(arg, arguments);
+        }
+
+        detail::special_arguments special = detail::scan_special_arguments(std::move(arguments));
+        special.error.throw_if_failed();
+
+        if (special.version_check.has_value())
+            version_check_user_decision = *special.version_check;
+
+        cmd_arguments = std::move(special.remaining);
+
+        switch (special.format)
+        {
+            case detail::special_format::help:
                 format = detail::format_help{subcommands, false};
                 init_standard_options();
-                special_format_was_set = true;
-            }
-            else if (arg == "-hh" || arg == "--advanced-help")
-            {
+                break;
+            case detail::special_format::advanced_help:
                 format = detail::format_help{subcommands, true};
                 init_standard_options();
-                special_format_was_set = true;
-            }
-            else if (arg == "--version")
-            {
+                break;
+            case detail::special_format::version:
                 format = detail::format_version{};
-                special_format_was_set = true;
-            }
-            else if (arg.substr(0, 13) == "--export-help") // --export-help=man is also allowed
-            {
-                std::string export_format;
-
-                if (arg.size() > 13)
-                {
-                    export_format = arg.substr(14);
-                }
-                else
-                {
-                    if (argv_len <= i + 1)
-                        throw too_few_arguments{"Option --export-help must be followed by a value."};
-                    export_format = {argv[i+1]};
-                }
-
-                if (export_format == "html")
-                    format = detail::format_html{subcommands};
-                else if (export_format == "man")
-                    format = detail::format_man{subcommands};
-                // TODO (smehringer) use when CTD support is available
-                // else if (export_format == "ctd")
-                //     format = detail::format_ctd{};
-                else
-                    throw validation_error{"Validation failed for option --export-help: "
-                                            "Value must be one of [html, man]"};
-                init_standard_options();
-                special_format_was_set = true;
-            }
-            else if (arg == "--copyright")
-            {
+                break;
+            case detail::special_format::copyright:
                 format = detail::format_copyright{};
-                special_format_was_set = true;
-            }
-            else if (arg == "--version-check")
-            {
-                if (++i >= argv_len)
-                    throw too_few_arguments{"Option --version-check must be followed by a value."};
-
-                arg = argv[i];
-
-                if (arg == "1" || arg == "true")
-                    version_check_user_decision = true;
-                else if (arg == "0" || arg == "false")
-                    version_check_user_decision = false;
-                else
-                    throw validation_error{"Value for option --version-check must be true (1) or false (0)."};
-
-                // in case --version-check is specified it shall not be passed to format_parse()
-                argc -= 2;
-            }
-            else
-            {
-                cmd_arguments.push_back(std::move(arg));
-            }
+                break;
+            case detail::special_format::export_html:
+                format = detail::format_html{subcommands};
+                init_standard_options();
+                break;
+            case detail::special_format::export_man:
+                format = detail::format_man{subcommands};
+                init_standard_options();
+                break;
+            // TODO (smehringer) use when CTD support is available
+            // case detail::special_format::export_ctd:
+            //     format = detail::format_ctd{};
+            //     break;
+            case detail::special_format::none:
+                format = detail::format_parse(static_cast<int>(cmd_arguments.size()) + 1,
+                                              cmd_arguments,
+                                              std::move(special.removed_indices));
+                break;
         }
-
-        if (!special_format_was_set)
-            format = detail::format_parse(argc, cmd_arguments);
     }
 
     //!\brief Adds standard options to the help page.
@@ -842,8 +1049,11 @@ private:
      */
     void verify_identifiers(char const short_id, std::string const & long_id)
     {
-        constexpr std::string_view valid_chars{"@_0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"};
-        auto is_valid = [&valid_chars] (char const c) { return valid_chars.find(c) != std::string::npos; };
+        if (option_schema_ids.has_value())
+        {
+            verify_schema_identifiers(short_id, long_id);
+            return;
+        }
 
         if (id_exists(short_id))
             throw design_error("Option Identifier '" + std::string(1, short_id) + "' was already used before.");
@@ -851,19 +1061,66 @@ private:
             throw design_error("Option Identifier '" + long_id + "' was already used before.");
         if (long_id.length() == 1)
             throw design_error("Long IDs must be either empty, or longer than one character.");
-        if ((short_id != '\0') && !is_valid(short_id))
+        if ((short_id != '\0') && !detail::is_char_of(short_id, detail::short_id_chars))
             throw design_error("Option identifiers may only contain alphanumeric characters, '_', or '@'.");
         if (long_id.size() > 0 && (long_id[0] == '-'))
             throw design_error("First character of long ID cannot be '-'.");
 
-        std::for_each(long_id.begin(), long_id.end(), [&is_valid] (char c)
-                      {
-                          if (!((c == '-') || is_valid(c)))
-                              throw design_error("Long identifiers may only contain alphanumeric characters, '_', '-', or '@'.");
-                      });
+        if (!long_id.empty() && !detail::consists_of(long_id, detail::long_id_chars))
+            throw design_error("Long identifiers may only contain alphanumeric characters, '_', '-', or '@'.");
         if (detail::format_parse::is_empty_id(short_id) && detail::format_parse::is_empty_id(long_id))
             throw design_error("Option Identifiers cannot both be empty.");
     }
+
+    /*!\brief Verifies that the short and the long identifiers are declared in the option schema.
+     * \param[in] short_id The short identifier of the command line option/flag.
+     * \param[in] long_id  The long identifier of the command line option/flag.
+     * \throws sharg::design_error
+     * \details The identifiers themselves were already verified at compile time. This only checks that the pair is
+     *          declared in the schema and that it was not added before.
+     */
+    void verify_schema_identifiers(char const short_id, std::string const & long_id)
+    {
+        size_t const index = long_id.empty() ? option_schema_ids->find_short_id(short_id)
+                                              : option_schema_ids->find_long_id(long_id);
+        std::string const ids = ((short_id == '\0') ? std::string{} : std::string{'\'', short_id, '\''}) +
+                                ((short_id == '\0' || long_id.empty()) ? "" : "/") +
+                                (long_id.empty() ? std::string{} : "'" + long_id + "'");
+
+        if (index == detail::option_schema_view::npos ||
+            option_schema_ids->identifiers()[index].short_id != short_id ||
+            option_schema_ids->identifiers()[index].long_id != long_id)
+        {
+            throw design_error("Option Identifiers " + ids + " are not declared in the option schema.");
+        }
+
+        if (registered_schema_ids[index])
+            throw design_error("Option Identifier " + ids + " was already used before.");
+
+        registered_schema_ids[index] = true;
+    }
+
+    /*!\brief Checks whether an option or flag with the given identifier was added (or is a built-in one).
+     * \param[in] id The short or long identifier.
+     */
+    template <typename id_type>
+    bool id_was_added(id_type const & id) const
+    {
+        if (option_schema_ids.has_value())
+        {
+            size_t index{detail::option_schema_view::npos};
+
+            if constexpr (std::same_as<id_type, char>)
+                index = option_schema_ids->find_short_id(id);
+            else
+                index = option_schema_ids->find_long_id(id);
+
+            if (index != detail::option_schema_view::npos && registered_schema_ids[index])
+                return true;
+        }
+
+        return used_option_ids.contains(std::string({id}));
+    }
 };
 
 } // namespace sharg
@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides sharg::parser_schema.
+ */
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include <sharg/parser.hpp>
+
+namespace sharg
+{
+
+/*!\brief The options of an application, set up once and used to validate many command lines.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * sharg::parser is constructed from a single command line and can only parse it once. If many command lines need to
+ * be checked against the same options (e.g. a workflow manager validating the calls of a tool before submitting
+ * them), setting up a sharg::parser for each of them repeats the verification of all identifiers and the
+ * construction of all validators.
+ *
+ * A sharg::parser_schema is set up exactly like a sharg::parser, but without a command line. Afterwards, it is
+ * immutable and parser_schema::validate creates a light-weight parse context per command line that shares the
+ * options, validators and identifier index of the schema. The bound variables are only used as defaults and to
+ * determine the type of the options: validate() never assigns to them. Hence, validate() may be called concurrently
+ * from any number of threads, as long as the bound variables are not modified while doing so (the validators
+ * provided by Sharg can be called concurrently; custom validators must be as well).
+ *
+ * ```cpp
+ * int number{};
+ * std::string file{};
+ *
+ * sharg::parser_schema schema{"my_app"};
+ * schema.add_option(number, 'n', "number", "A number.", sharg::option_spec::required);
+ * schema.add_positional_option(file, "A file.");
+ *
+ * sharg::parse_result result = schema.validate({"my_app", "-n", "3", "file.txt"});
+ * ```
+ *
+ * validate() reports the same errors as sharg::parser::try_parse. Command lines that only print information when
+ * passed to the application (no arguments, `-h/--help`, `-hh/--advanced-help`, `--version`, `--copyright` and
+ * `--export-help`) are valid. Subcommands are not supported.
+ *
+ * The bound variables must outlive the schema.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class parser_schema
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parser_schema() = delete;                                  //!< Deleted.
+    parser_schema(parser_schema const &) = delete;             //!< Deleted, the parse contexts refer to the schema.
+    parser_schema & operator=(parser_schema const &) = delete; //!< Deleted, the parse contexts refer to the schema.
+    parser_schema(parser_schema &&) = delete;                  //!< Deleted, the parse contexts refer to the schema.
+    parser_schema & operator=(parser_schema &&) = delete;      //!< Deleted, the parse contexts refer to the schema.
+    ~parser_schema() = default;                                //!< Defaulted.
+
+    /*!\brief Creates a schema without any options.
+     * \param[in] app_name The name of the app; the same restrictions as for sharg::parser apply.
+     * \throws sharg::design_error if the application name contains illegal characters.
+     */
+    explicit parser_schema(std::string const app_name) :
+        setup{std::move(app_name), 1, nullptr, update_notifications::off} // argv is not accessed for argc == 1
+    {
+        setup.format = detail::format_parse{1, {}};
+    }
+    //!\}
+
+    /*!\name Adding options
+     * \brief Add (positional) options and flags to the schema.
+     * \{
+     */
+    /*!\brief Adds an option to the schema.
+     * \copydetails sharg::parser::add_option
+     */
+    template <typename option_type, validator validator_type = detail::default_validator>
+    //!\cond
+        requires (parser_compatible_option<option_type> ||
+                  parser_compatible_option<std::ranges::range_value_t<option_type>>) &&
+                  std::invocable<validator_type, option_type>
+    //!\endcond
+    void add_option(option_type & value,
+                    char const short_id,
+                    std::string const & long_id,
+                    std::string const & desc,
+                    option_spec const spec = option_spec::standard,
+                    validator_type option_validator = validator_type{})
+    {
+        setup.add_option(value, short_id, long_id, desc, spec, std::move(option_validator));
+    }
+
+    /*!\brief Adds a flag to the schema.
+     * \copydetails sharg::parser::add_flag
+     */
+    void add_flag(bool & value,
+                  char const short_id,
+                  std::string const & long_id,
+                  std::string const & desc,
+                  option_spec const spec = option_spec::standard)
+    {
+        setup.add_flag(value, short_id, long_id, desc, spec);
+    }
+
+    /*!\brief Adds a positional option to the schema.
+     * \copydetails sharg::parser::add_positional_option
+     */
+    template <typename option_type, validator validator_type = detail::default_validator>
+    //!\cond
+        requires (parser_compatible_option<option_type> ||
+                  parser_compatible_option<std::ranges::range_value_t<option_type>>) &&
+                  std::invocable<validator_type, option_type>
+    //!\endcond
+    void add_positional_option(option_type & value,
+                               std::string const & desc,
+                               validator_type option_validator = validator_type{})
+    {
+        setup.add_positional_option(value, desc, std::move(option_validator));
+    }
+
+    /*!\brief Adds a positional list option to the schema that hands over each value as soon as it is parsed.
+     * \copydetails sharg::parser::add_positional_option(sink_type, std::string const &, validator_type)
+     *
+     * validate() only checks the values and never calls the sink.
+     */
+    template <typename value_type, typename sink_type, validator validator_type = detail::default_validator>
+    //!\cond
+        requires parser_compatible_option<value_type> &&
+                 (std::invocable<sink_type &, value_type> || std::output_iterator<sink_type, value_type>) &&
+                 std::invocable<validator_type, value_type>
+    //!\endcond
+    void add_positional_option(sink_type sink,
+                               std::string const & desc,
+                               validator_type option_validator = validator_type{})
+    {
+        setup.template add_positional_option<value_type>(std::move(sink), desc, std::move(option_validator));
+    }
+
+    /*!\brief Allows several values of a list option in a single argument.
+     * \copydetails sharg::parser::set_list_delimiter
+     */
+    template <typename id_type>
+    //!\cond
+        requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
+    //!\endcond
+    void set_list_delimiter(id_type const & id, char const delimiter)
+    {
+        setup.set_list_delimiter(id, delimiter);
+    }
+    //!\}
+
+    /*!\brief Validates a command line against the schema.
+     * \param[in] argc The number of command line arguments.
+     * \param[in] argv The command line arguments, `argv[0]` is the program name.
+     * \returns The same result as sharg::parser::try_parse.
+     *
+     * \details
+     *
+     * \copydetails sharg::parser_schema::validate(std::vector<std::string_view> const &) const
+     */
+    parse_result validate(int const argc, char const * const * const argv) const
+    {
+        return validate(std::vector<std::string_view>(argv, argv + argc));
+    }
+
+    /*!\brief Validates a command line against the schema.
+     * \param[in] arguments The command line arguments, `arguments[0]` is the program name.
+     * \returns The same result as sharg::parser::try_parse.
+     *
+     * \details
+     *
+     * Response files (`@file`) are expanded like in sharg::parser, relative to the current working directory; the
+     * argument index of an error refers to the expanded command line. The arguments are not copied and must outlive
+     * the returned result. This function is thread-safe.
+     */
+    parse_result validate(std::vector<std::string_view> const & arguments) const
+    {
+        if (arguments.size() <= 1) // the application prints the short help page
+            return {};
+
+        detail::response_file_expander response_files{};
+        std::vector<std::string_view> expanded{}; // the program name is not passed on to format_parse
+        expanded.reserve(arguments.size() - 1);
+
+        for (size_t i = 1; i < arguments.size(); ++i)
+        {
+            size_t const position = expanded.size() + 1;
+
+            try
+            {
+                response_files.expand(arguments[i], expanded);
+            }
+            catch (user_input_error const & ex)
+            {
+                return {parse_error_kind::user_input_error, position, {},
+                        [message = std::string{ex.what()}] (parse_result const &) { return message; }};
+            }
+        }
+
+        parse_result result = validate_expanded(std::move(expanded));
+
+        if (result.success() || response_files.empty())
+            return result;
+
+        // the message may refer to the arguments in the response files, which are unmapped on return
+        return {result.kind(), result.argument_index(), std::string{result.option_id()},
+                [message = result.message()] (parse_result const &) { return message; }};
+    }
+
+private:
+    //!\brief Validates the arguments (without the program name) after the response files were expanded.
+    parse_result validate_expanded(std::vector<std::string_view> arguments) const
+    {
+        detail::special_arguments special = detail::scan_special_arguments(std::move(arguments));
+
+        if (!special.error.success() || special.format != detail::special_format::none)
+            return special.error; // if valid, the application prints information and exits
+
+        detail::format_parse context{std::get<detail::format_parse>(setup.format),
+                                     static_cast<int>(special.remaining.size() + 1),
+                                     std::move(special.remaining),
+                                     std::move(special.removed_indices)};
+        context.parse(setup.info);
+        return context.result();
+    }
+
+    //!\brief The parser that the options were added to; its format_parse is the prototype of all parse contexts.
+    parser setup;
+};
+
+} // namespace sharg
@@ -12,15 +12,33 @@
 
 #pragma once
 
+#include <algorithm>
 #include <any>
+#include <bit>
 #include <concepts>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <numeric>
 #include <ranges>
 #include <regex>
 
+#ifndef _WIN32
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+#include <sharg/detail/created_files.hpp>
+#include <sharg/detail/file_status_cache.hpp>
+#include <sharg/detail/regex_dfa.hpp>
 #include <sharg/detail/safe_filesystem_entry.hpp>
 #include <sharg/detail/to_string.hpp>
+#include <sharg/detail/work_stealing_pool.hpp>
 #include <sharg/exceptions.hpp>
+#include <sharg/file_handle.hpp>
 
 namespace sharg
 {
@@ -93,10 +111,18 @@ public:
      */
     void operator()(option_value_type const & cmp) const
     {
-        if (!((cmp <= max) && (cmp >= min)))
+        if (!is_in_range(cmp))
             throw validation_error{"Value " + std::to_string(cmp) + " is not in range " + valid_range_str + "."};
     }
 
+    /*!\brief Returns whether cmp lies inside [`min`, `max`], i.e. whether operator() accepts it.
+     * \param cmp The input value to check.
+     */
+    bool is_in_range(option_value_type const & cmp) const noexcept
+    {
+        return (cmp <= max) && (cmp >= min);
+    }
+
     /*!\brief Tests whether every element in \p range lies inside [`min`, `max`].
      * \tparam range_type The type of range to check; must model std::ranges::forward_range. The value type must model
      *                    std::is_arithmetic_v.
@@ -146,6 +172,14 @@ private:
  *
  * \include test/snippet/validators_2.cpp
  *
+ * For more than value_list_validator::linear_search_threshold valid values, an index is built on construction:
+ * a hash table if the option value type can be hashed via std::hash, otherwise a sorted index if the type is totally
+ * ordered. A value is then looked up in (expected) constant or logarithmic time instead of comparing it to every
+ * valid value, which matters for e.g. validating thousands of chromosome names against a large reference. The index
+ * only stores positions of the valid values and is shared by copies of the validator.
+ *
+ * The help page message and the error message list at most value_list_validator::max_listed_values valid values.
+ *
  * \remark For a complete overview, take a look at \ref parser
  */
 template <parser_compatible_option option_value_t>
@@ -178,6 +212,7 @@ public:
     {
         values.clear();
         std::move(rng.begin(), rng.end(), std::back_inserter(values));
+        build_index();
     }
 
     /*!\brief Constructing from a parameter pack.
@@ -192,17 +227,23 @@ public:
     value_list_validator(option_types && ...opts)
     {
         (values.emplace_back(std::forward<option_types>(opts)), ...);
+        build_index();
     }
     //!\}
 
+    //!\brief Up to this number of valid values, a value is compared to every valid value instead of using an index.
+    static constexpr size_t linear_search_threshold{32};
+    //!\brief The maximal number of valid values that are listed in the help page and error messages.
+    static constexpr size_t max_listed_values{20};
+
     /*!\brief Tests whether cmp lies inside values.
      * \param cmp The input value to check.
      * \throws sharg::validation_error
      */
     void operator()(option_value_type const & cmp) const
     {
-        if (!(std::find(values.begin(), values.end(), cmp) != values.end()))
-            throw validation_error{detail::to_string("Value ", cmp, " is not one of ", values,".")};
+        if (!contains(cmp))
+            throw validation_error{detail::to_string("Value ", cmp, " is not one of ", listed_values(), ".")};
     }
 
     /*!\brief Tests whether every element in \p range lies inside values.
@@ -216,18 +257,102 @@ public:
     //!\endcond
     void operator()(range_type const & range) const
     {
-        std::for_each(std::ranges::begin(range), std::ranges::end(range), [&] (auto cmp) { (*this)(cmp); });
+        std::for_each(std::ranges::begin(range), std::ranges::end(range), [&] (auto && cmp) { (*this)(cmp); });
     }
 
     //!\brief Returns a message that can be appended to the (positional) options help page info.
     std::string get_help_page_message() const
     {
-        return detail::to_string("Value must be one of ", values, ".");
+        return detail::to_string("Value must be one of ", listed_values(), ".");
     }
 
 private:
-    //!\brief Minimum of the range to test.
+    //!\brief Whether option_value_type can be hashed via std::hash.
+    static constexpr bool is_hashable = requires (option_value_type const & value)
+    {
+        { std::hash<option_value_type>{}(value) } -> std::convertible_to<size_t>;
+    };
+
+    //!\brief Whether cmp is one of the valid values.
+    bool contains(option_value_type const & cmp) const
+    {
+        if (index == nullptr)
+            return std::find(values.begin(), values.end(), cmp) != values.end();
+
+        if constexpr (is_hashable)
+        {
+            // open addressing with linear probing; a slot holds the position of a value + 1 or 0 if it is empty
+            size_t const mask{index->size() - 1};
+
+            for (size_t slot = std::hash<option_value_type>{}(cmp) & mask; (*index)[slot] != 0;
+                 slot = (slot + 1) & mask)
+            {
+                if (values[(*index)[slot] - 1] == cmp)
+                    return true;
+            }
+
+            return false;
+        }
+        else
+        {
+            auto it = std::ranges::lower_bound(*index, cmp, std::less<>{}, [this] (size_t const i) -> auto const &
+            {
+                return values[i];
+            });
+            return it != index->end() && values[*it] == cmp;
+        }
+    }
+
+    //!\brief Builds the hash table or the sorted index for more than linear_search_threshold values.
+    void build_index()
+    {
+        if (values.size() <= linear_search_threshold)
+            return;
+
+        if constexpr (is_hashable)
+        {
+            size_t const table_size = std::bit_ceil(values.size() * 2); // load factor of at most 0.5
+            std::vector<size_t> table(table_size, 0);
+            size_t const mask{table_size - 1};
+
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                size_t slot = std::hash<option_value_type>{}(values[i]) & mask;
+
+                while (table[slot] != 0 && !(values[table[slot] - 1] == values[i]))
+                    slot = (slot + 1) & mask;
+
+                if (table[slot] == 0) // duplicates are only inserted once
+                    table[slot] = i + 1;
+            }
+
+            index = std::make_shared<std::vector<size_t> const>(std::move(table));
+        }
+        else if constexpr (std::totally_ordered<option_value_type>)
+        {
+            std::vector<size_t> sorted(values.size());
+            std::iota(sorted.begin(), sorted.end(), 0);
+            std::ranges::sort(sorted, std::less<>{}, [this] (size_t const i) -> auto const & { return values[i]; });
+            index = std::make_shared<std::vector<size_t> const>(std::move(sorted));
+        }
+    }
+
+    //!\brief Prints the valid values, but at most max_listed_values of them.
+    std::string listed_values() const
+    {
+        if (values.size() <= max_listed_values)
+            return detail::to_string(values);
+
+        std::vector<option_value_type> const listed{values.begin(), values.begin() + max_listed_values};
+        std::string result = detail::to_string(listed);
+        result.pop_back(); // ']'
+        return detail::to_string(result, ", ...] (", values.size(), " values in total)");
+    }
+
+    //!\brief The valid values.
     std::vector<option_value_type> values{};
+    //!\brief The hash table or the sorted index if there are more than linear_search_threshold values.
+    std::shared_ptr<std::vector<size_t> const> index{};
 };
 
 /*!\brief Type deduction guides
@@ -319,6 +444,11 @@ public:
          std::for_each(v.begin(), v.end(), [&] (auto cmp) { this->operator()(cmp); });
     }
 
+    //!\brief Lists of paths are checked the paths in parallel if there are at least this many.
+    static constexpr size_t parallel_threshold{32};
+    //!\brief The maximal number of threads used to check a list of paths.
+    static constexpr size_t max_threads{16};
+
 protected:
     /*!\brief Validates the given filename path based on the specified extensions.
      * \param path The filename path.
@@ -367,23 +497,31 @@ protected:
      *         std::filesystem::filesystem_error on underlying OS API errors.
      */
     void validate_readability(std::filesystem::path const & path) const
+    {
+        validate_readability(path, detail::file_status_cache::status(path));
+    }
+
+    /*!\brief Checks if the given path is readable, using its already queried status.
+     * \param path   The path to check.
+     * \param status The status of `path`.
+     * \throws sharg::validation_error if the path is not readable.
+     */
+    void validate_readability(std::filesystem::path const & path, detail::file_status const & status) const
     {
         // Check if input directory is readable.
-        if (std::filesystem::is_directory(path))
+        if (status.type == detail::file_status::file_type::directory)
         {
-            std::error_code ec{};
-            std::filesystem::directory_iterator{path, ec};  // if directory iterator cannot be created, ec will be set.
-            if (static_cast<bool>(ec))
+            if (!detail::file_status_cache::readable(path))
                 throw validation_error{"Cannot read the directory \"" + path.string() + "\"!"};
         }
         else
         {
             // Must be a regular file.
-            if (!std::filesystem::is_regular_file(path))
+            if (status.type != detail::file_status::file_type::regular)
                 throw validation_error{"Expected a regular file \"" + path.string() + "\"!"};
 
-            std::ifstream file{path};
-            if (!file.is_open() || !file.good())
+            // Checks the permissions without opening the file.
+            if (!detail::file_status_cache::readable(path))
                 throw validation_error{"Cannot read the file \"" + path.string() + "\"!"};
         }
     }
@@ -406,6 +544,97 @@ protected:
             throw validation_error{"Cannot write \"" + path.string() + "\"!"};
 
         file_guard.remove();
+        detail::file_status_cache::invalidate(path); // the file system was modified
+    }
+
+    /*!\brief Checks if an entry can be created at the given, not existing path without writing anything.
+     * \param path The path to check.
+     * \returns `true` if the parent directory exists and grants write and search permission, `false` otherwise.
+     *
+     * \details
+     *
+     * In contrast to validate_writeability, no file is created, i.e. the validation does not change the file system
+     * and costs one `statx` and one `faccessat` call. The parent of a relative path without parent is the current
+     * working directory.
+     */
+    bool parent_is_writable(std::filesystem::path const & path) const
+    {
+        std::filesystem::path parent{path.has_filename() ? path.parent_path() : path.parent_path().parent_path()};
+
+        if (parent.empty())
+            parent = ".";
+
+        detail::file_status status{};
+        std::error_code const error = detail::file_status_cache::status(parent, status);
+
+        return !error && status.type == detail::file_status::file_type::directory &&
+               detail::file_status_cache::writable(parent, true);
+    }
+
+    /*!\brief Validates every path in \p v and reports all invalid paths at once.
+     * \tparam range_type The type of range to check; the value type must be convertible to std::filesystem::path.
+     * \param  v          The paths to check.
+     * \throws sharg::validation_error listing every path that failed the validation.
+     *
+     * \details
+     *
+     * The paths are checked with operator()(std::filesystem::path const &). For at least parallel_threshold paths,
+     * the checks are spread over a detail::work_stealing_pool: they mostly wait for the file system, which is slow
+     * on network file systems, so up to max_threads threads are used independent of the number of cores.
+     * If the validator already runs on a pool worker (e.g. in sharg::validate_batch, which validates the command
+     * lines in parallel), the paths are checked sequentially instead of starting a nested pool.
+     * If a single path is invalid, its error message is thrown unchanged.
+     */
+    template <std::ranges::forward_range range_type>
+    void validate_all(range_type const & v) const
+    {
+        std::vector<std::filesystem::path> paths{};
+        for (auto && path : v)
+            paths.emplace_back(path);
+
+        std::vector<std::string> errors(paths.size());
+        detail::file_status_cache * const cache = detail::file_status_cache::current();
+
+        auto validate_path = [&] (size_t const index)
+        {
+            detail::file_status_cache::scope const use_cache{cache}; // share the cache of the calling thread
+
+            try
+            {
+                (*this)(paths[index]);
+            }
+            catch (validation_error const & ex)
+            {
+                errors[index] = ex.what();
+            }
+        };
+
+        if (paths.size() < parallel_threshold || detail::work_stealing_pool::is_worker_thread())
+        {
+            for (size_t i = 0; i < paths.size(); ++i)
+                validate_path(i);
+        }
+        else
+        {
+            detail::work_stealing_pool pool{std::min(max_threads, paths.size() / parallel_threshold)};
+            pool.run(paths.size(), validate_path);
+        }
+
+        size_t const error_count = paths.size() - std::ranges::count(errors, std::string{});
+
+        if (error_count == 0)
+            return;
+
+        if (error_count == 1)
+            throw validation_error{*std::ranges::find_if(errors, [] (auto const & e) { return !e.empty(); })};
+
+        std::string message{std::to_string(error_count) + " of " + std::to_string(paths.size()) +
+                            " paths are invalid:"};
+        for (std::string const & error : errors)
+            if (!error.empty())
+                message += "\n" + error;
+
+        throw validation_error{message};
     }
 
     //!\brief Returns the information of valid file extensions.
@@ -496,9 +725,6 @@ public:
     using file_validator_base::file_validator_base;
     //!\}
 
-    // Import the base::operator()
-    using file_validator_base::operator();
-
     /*!\brief Tests whether path is an existing regular file and is readable.
      * \param file The input value to check.
      * \throws sharg::validation_error if the validation process failed. Might be nested with
@@ -508,11 +734,13 @@ public:
     {
         try
         {
-            if (!std::filesystem::exists(file))
+            detail::file_status const status = detail::file_status_cache::status(file);
+
+            if (!status.exists())
                 throw validation_error{"The file \"" + file.string() + "\" does not exist!"};
 
             // Check if file is regular and can be opened for reading.
-            validate_readability(file);
+            validate_readability(file, status);
 
             // Check extension.
             validate_filename(file);
@@ -529,6 +757,26 @@ public:
         }
     }
 
+    /*!\brief Tests whether every path in list \p v passes validation and reports all invalid paths at once.
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range and the value type must
+     *                    be convertible to std::filesystem::path.
+     * \param  v          The input range to iterate over and check every element.
+     * \throws sharg::validation_error listing every invalid path.
+     *
+     * \details
+     *
+     * Long lists are checked in parallel, see file_validator_base::validate_all.
+     */
+    template <std::ranges::forward_range range_type>
+    //!\cond
+        requires (std::convertible_to<std::ranges::range_value_t<range_type>, std::filesystem::path const &>
+                 && !std::convertible_to<range_type, std::filesystem::path const &>)
+    //!\endcond
+    void operator()(range_type const & v) const
+    {
+        validate_all(v);
+    }
+
     //!\brief Returns a message that can be appended to the (positional) options help page info.
     std::string get_help_page_message() const
     {
@@ -538,6 +786,161 @@ public:
     }
 };
 
+//!\brief How sharg::input_file_open_validator provides the file: as a descriptor or additionally memory mapped.
+enum class input_file_open_options
+{
+    //!\brief Open the file and keep the descriptor.
+    descriptor,
+    //!\brief Open the file, keep the descriptor and map the file read-only into memory.
+    memory_map
+};
+
+/*!\brief A validator that opens a sharg::input_file_handle and hands the open file to the application.
+ * \ingroup parser
+ * \implements sharg::validator
+ *
+ * \details
+ *
+ * The validator performs the checks of sharg::input_file_validator, but on the opened file: it opens the path
+ * read-only, requires a regular file and checks the extension. On success, the file stays open and the application
+ * obtains it via sharg::input_file_handle::descriptor() (and sharg::input_file_handle::contents() for
+ * sharg::input_file_open_options::memory_map). This saves the second open and there is no window in which the path
+ * could be replaced between the validation and the application opening it.
+ *
+ * ```cpp
+ * sharg::input_file_handle reads{};
+ * parser.add_option(reads, 'i', "input", "The reads.", sharg::option_spec::required,
+ *                   sharg::input_file_open_validator{sharg::input_file_open_options::memory_map, {"fa", "fasta"}});
+ * parser.parse();
+ * std::string_view const file_contents = reads.contents();
+ * ```
+ *
+ * \note Opening files is only supported on POSIX systems. Elsewhere, the validator behaves like
+ *       sharg::input_file_validator and the handle is not opened.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class input_file_open_validator : public input_file_validator
+{
+public:
+    //!\brief Type of values that are tested by validator.
+    using option_value_type = input_file_handle;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    input_file_open_validator() = default;                                              //!< Defaulted.
+    input_file_open_validator(input_file_open_validator const &) = default;             //!< Defaulted.
+    input_file_open_validator(input_file_open_validator &&) = default;                  //!< Defaulted.
+    input_file_open_validator & operator=(input_file_open_validator const &) = default; //!< Defaulted.
+    input_file_open_validator & operator=(input_file_open_validator &&) = default;      //!< Defaulted.
+    virtual ~input_file_open_validator() = default;                                     //!< Virtual destructor.
+
+    /*!\brief Constructs from a given open mode and a list of valid extensions.
+     * \param[in] mode       Whether the file is only opened or also memory mapped.
+     * \param[in] extensions The valid extensions to validate for.
+     */
+    explicit input_file_open_validator(input_file_open_options const mode, std::vector<std::string> extensions = {}) :
+        input_file_validator{std::move(extensions)}, open_mode{mode}
+    {}
+
+    /*!\brief Constructs from a list of valid extensions; the file is only opened.
+     * \param[in] extensions The valid extensions to validate for.
+     */
+    explicit input_file_open_validator(std::vector<std::string> extensions) :
+        input_file_validator{std::move(extensions)}
+    {}
+    //!\}
+
+    // Import the path based checks of the input_file_validator.
+    using input_file_validator::operator();
+
+    /*!\brief Opens the file of `handle`, checks it and keeps it open.
+     * \param handle The handle to open.
+     * \throws sharg::validation_error if the file cannot be opened, is not a regular file or has an invalid extension.
+     *
+     * \details
+     *
+     * A handle that is already open is not opened again.
+     */
+    void operator()(input_file_handle const & handle) const
+    {
+        if (handle.is_open())
+            return;
+
+#ifndef _WIN32
+        std::filesystem::path const & file = handle.path();
+        // O_NONBLOCK: opening a FIFO must not wait for a writer; it is rejected below.
+        int const descriptor = ::open(file.c_str(), O_RDONLY | O_CLOEXEC | O_NOCTTY | O_NONBLOCK);
+
+        if (descriptor < 0)
+        {
+            if (errno == ENOENT || errno == ENOTDIR)
+                throw validation_error{"The file \"" + file.string() + "\" does not exist!"};
+
+            throw validation_error{"Cannot read the file \"" + file.string() + "\"!"};
+        }
+
+        // Closes the descriptor unless it is attached to the handle.
+        struct descriptor_guard_t
+        {
+            int descriptor;
+            ~descriptor_guard_t()
+            {
+                if (descriptor >= 0)
+                    close(descriptor);
+            }
+        } descriptor_guard{descriptor};
+
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+            throw validation_error{"Expected a regular file \"" + file.string() + "\"!"};
+
+        fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) & ~O_NONBLOCK);
+
+        validate_filename(file);
+
+        char const * data{nullptr};
+        size_t const size{static_cast<size_t>(status.st_size)};
+
+        if (open_mode == input_file_open_options::memory_map && size > 0)
+        {
+            void * const mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+            if (mapping == MAP_FAILED)
+                throw validation_error{"Cannot map the file \"" + file.string() + "\" into memory!"};
+
+            data = static_cast<char const *>(mapping);
+        }
+
+        descriptor_guard.descriptor = -1;
+        handle.attach(descriptor, data, data != nullptr ? size : 0);
+#else
+        input_file_validator::operator()(handle.path());
+#endif
+    }
+
+    /*!\brief Opens every handle in \p handles, see operator()(input_file_handle const &).
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range over
+     *                    sharg::input_file_handle.
+     * \param  handles    The handles to open.
+     * \throws sharg::validation_error
+     */
+    template <std::ranges::forward_range range_type>
+    //!\cond
+        requires std::same_as<std::ranges::range_value_t<range_type>, input_file_handle>
+    //!\endcond
+    void operator()(range_type const & handles) const
+    {
+        for (input_file_handle const & handle : handles)
+            (*this)(handle);
+    }
+
+private:
+    //!\brief Whether the file is only opened or also memory mapped.
+    input_file_open_options open_mode{input_file_open_options::descriptor};
+};
+
 //!\brief Mode of an output file: Determines whether an existing file can be (silently) overwritten.
 enum class output_file_open_options
 {
@@ -640,16 +1043,30 @@ public:
      * \param file The input value to check.
      * \throws sharg::validation_error if the validation process failed. Might be nested with
      *         std::filesystem::filesystem_error on unhandled OS API errors.
+     *
+     * \details
+     *
+     * The permissions are checked without creating or opening the file, so an existing file is left untouched and no
+     * file system watcher observes the validation.
      */
     virtual void operator()(std::filesystem::path const & file) const override
     {
         try
         {
-            if ((open_mode == output_file_open_options::create_new) && std::filesystem::exists(file))
+            detail::file_status const status = detail::file_status_cache::status(file);
+
+            if ((open_mode == output_file_open_options::create_new) && status.exists())
                 throw validation_error{"The file \"" + file.string() + "\" already exists!"};
 
-            // Check if file has any write permissions.
-            validate_writeability(file);
+            // Check if file has any write permissions: an existing file must be writable, otherwise the file must be
+            // creatable in the parent directory.
+            bool const writable = status.exists() ?
+                                  status.type != detail::file_status::file_type::directory &&
+                                  detail::file_status_cache::writable(file) :
+                                  parent_is_writable(file);
+
+            if (!writable)
+                throw validation_error{"Cannot write \"" + file.string() + "\"!"};
 
             validate_filename(file);
         }
@@ -689,6 +1106,196 @@ private:
     output_file_open_options open_mode{output_file_open_options::create_new};
 };
 
+/*!\brief A validator that creates the file of a sharg::output_file_handle and hands the open file to the application.
+ * \ingroup parser
+ * \implements sharg::validator
+ *
+ * \details
+ *
+ * The validator performs the checks of sharg::output_file_validator by creating the file: with
+ * sharg::output_file_open_options::create_new, the file is created atomically (`O_CREAT | O_EXCL`), i.e. the
+ * validation fails if the file exists, even if another process creates it after the parser checked the path.
+ * With sharg::output_file_open_options::open_or_create, an existing regular file is opened (but not truncated).
+ * On success, the file stays open for writing and the application obtains it via
+ * sharg::output_file_handle::descriptor().
+ *
+ * If a size hint is given, the space for the file is reserved on creation (`fallocate` on Linux; the file size stays
+ * 0). The validation fails if there is not enough space; if the file system cannot reserve space, the hint is ignored.
+ * Reserved space that is not written remains allocated until the file is truncated.
+ *
+ * ```cpp
+ * sharg::output_file_handle out{};
+ * parser.add_option(out, 'o', "output", "The alignments.", sharg::option_spec::required,
+ *                   sharg::output_file_open_validator{sharg::output_file_open_options::create_new, {"sam"}, 1 << 30});
+ * parser.parse();
+ * write(out.descriptor(), data, size);
+ * ```
+ *
+ * If parsing fails after the file was created, the empty file is removed when the handle is destroyed,
+ * see sharg::output_file_handle.
+ *
+ * \note Creating files is only supported on POSIX systems. Elsewhere, the validator behaves like
+ *       sharg::output_file_validator and the handle is not opened.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class output_file_open_validator : public output_file_validator
+{
+public:
+    //!\brief Type of values that are tested by validator.
+    using option_value_type = output_file_handle;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    output_file_open_validator() = default;                                               //!< Defaulted.
+    output_file_open_validator(output_file_open_validator const &) = default;             //!< Defaulted.
+    output_file_open_validator(output_file_open_validator &&) = default;                  //!< Defaulted.
+    output_file_open_validator & operator=(output_file_open_validator const &) = default; //!< Defaulted.
+    output_file_open_validator & operator=(output_file_open_validator &&) = default;      //!< Defaulted.
+    virtual ~output_file_open_validator() = default;                                      //!< Virtual destructor.
+
+    /*!\brief Constructs from a given overwrite mode, a list of valid extensions and a size hint.
+     * \param[in] mode       A sharg::output_file_open_options indicating whether the validator throws if a file
+     *                       already exists.
+     * \param[in] extensions The valid extensions to validate for.
+     * \param[in] size_hint  The number of bytes to reserve for the file; 0 reserves nothing.
+     */
+    explicit output_file_open_validator(output_file_open_options const mode,
+                                        std::vector<std::string> const & extensions = {},
+                                        uint64_t const size_hint = 0) :
+        output_file_validator{mode, extensions}, file_open_mode{mode}, reserved_size{size_hint}
+    {}
+
+    /*!\brief Constructs from a list of valid extensions; the file must not exist.
+     * \param[in] extensions The valid extensions to validate for.
+     */
+    explicit output_file_open_validator(std::vector<std::string> const & extensions) :
+        output_file_open_validator{output_file_open_options::create_new, extensions}
+    {}
+    //!\}
+
+    // Import the path based checks of the output_file_validator.
+    using output_file_validator::operator();
+
+    /*!\brief Creates (or opens) the file of `handle` and keeps it open.
+     * \param handle The handle to open.
+     * \throws sharg::validation_error if the file has an invalid extension, exists (for
+     *         sharg::output_file_open_options::create_new), cannot be written or the reserved space is not available.
+     *
+     * \details
+     *
+     * The extension is checked before the file system is touched. If a later check fails, a created file is removed
+     * again. If the file was created during a parse that fails afterwards, it is removed at the end of the parse
+     * (unless something was written to it). A handle that is already open is not opened again.
+     *
+     * If the parse only validates the command line (sharg::parser_schema::validate), nothing is created: the path is
+     * checked like by sharg::output_file_validator and the handle stays closed.
+     */
+    void operator()(output_file_handle const & handle) const
+    {
+        if (handle.is_open())
+            return;
+
+        if (detail::created_files::is_dry_run())
+        {
+            output_file_validator::operator()(handle.path());
+            return;
+        }
+
+#ifndef _WIN32
+        std::filesystem::path const & file = handle.path();
+
+        validate_filename(file);
+
+        bool created{true};
+        int descriptor = ::open(file.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC | O_NOCTTY, 0666);
+
+        if (descriptor < 0 && errno == EEXIST)
+        {
+            if (file_open_mode == output_file_open_options::create_new)
+                throw validation_error{"The file \"" + file.string() + "\" already exists!"};
+
+            // O_NONBLOCK: opening a FIFO must not wait for a reader; it is rejected below.
+            created = false;
+            descriptor = ::open(file.c_str(), O_WRONLY | O_CLOEXEC | O_NOCTTY | O_NONBLOCK);
+        }
+
+        if (descriptor < 0)
+            throw validation_error{"Cannot write \"" + file.string() + "\"!"};
+
+        if (created)
+            detail::file_status_cache::invalidate(file);
+
+        // Closes the descriptor (and removes a created file) unless it is attached to the handle.
+        struct descriptor_guard_t
+        {
+            int descriptor;
+            char const * created_file;
+            ~descriptor_guard_t()
+            {
+                if (descriptor < 0)
+                    return;
+
+                if (created_file != nullptr)
+                    unlink(created_file);
+
+                close(descriptor);
+            }
+        } descriptor_guard{descriptor, created ? file.c_str() : nullptr};
+
+        if (!created)
+        {
+            struct stat status{};
+            if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+                throw validation_error{"Expected a regular file \"" + file.string() + "\"!"};
+
+            fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) & ~O_NONBLOCK);
+        }
+
+#   if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+        if (reserved_size > 0 &&
+            fallocate(descriptor, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(reserved_size)) != 0 &&
+            (errno == ENOSPC || errno == EDQUOT || errno == EFBIG))
+        {
+            throw validation_error{"Cannot reserve " + std::to_string(reserved_size) + " bytes for the file \"" +
+                                   file.string() + "\"!"};
+        }
+#   endif
+
+        descriptor_guard.descriptor = -1;
+        handle.attach(descriptor, created);
+
+        if (created) // removed again if the parse fails
+            detail::created_files::add([file = handle.file] () { file->remove_if_empty(); });
+#else
+        output_file_validator::operator()(handle.path());
+#endif
+    }
+
+    /*!\brief Creates every file in \p handles, see operator()(output_file_handle const &).
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range over
+     *                    sharg::output_file_handle.
+     * \param  handles    The handles to open.
+     * \throws sharg::validation_error
+     */
+    template <std::ranges::forward_range range_type>
+    //!\cond
+        requires std::same_as<std::ranges::range_value_t<range_type>, output_file_handle>
+    //!\endcond
+    void operator()(range_type const & handles) const
+    {
+        for (output_file_handle const & handle : handles)
+            (*this)(handle);
+    }
+
+private:
+    //!\brief Whether an existing file may be opened.
+    output_file_open_options file_open_mode{output_file_open_options::create_new};
+    //!\brief The number of bytes to reserve for a created file.
+    uint64_t reserved_size{0};
+};
+
 /*!\brief A validator that checks if a given path is a valid input directory.
  * \ingroup parser
  * \implements sharg::validator
@@ -725,9 +1332,6 @@ public:
     using file_validator_base::file_validator_base;
     //!\}
 
-    // Import the base::operator()
-    using file_validator_base::operator();
-
     /*!\brief Tests whether path is an existing directory and is readable.
      * \param dir The input value to check.
      * \throws sharg::validation_error if the validation process failed. Might be nested with
@@ -737,14 +1341,16 @@ public:
     {
         try
         {
-            if (!std::filesystem::exists(dir))
+            detail::file_status const status = detail::file_status_cache::status(dir);
+
+            if (!status.exists())
                 throw validation_error{"The directory \"" + dir.string() + "\" does not exists!"};
 
-            if (!std::filesystem::is_directory(dir))
+            if (status.type != detail::file_status::file_type::directory)
                 throw validation_error{"The path \"" + dir.string() + "\" is not a directory!"};
 
             // Check if directory has any read permissions.
-            validate_readability(dir);
+            validate_readability(dir, status);
         }
         // LCOV_EXCL_START
         catch (std::filesystem::filesystem_error & ex)
@@ -758,6 +1364,26 @@ public:
         }
     }
 
+    /*!\brief Tests whether every path in list \p v passes validation and reports all invalid paths at once.
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range and the value type must
+     *                    be convertible to std::filesystem::path.
+     * \param  v          The input range to iterate over and check every element.
+     * \throws sharg::validation_error listing every invalid path.
+     *
+     * \details
+     *
+     * Long lists are checked in parallel, see file_validator_base::validate_all.
+     */
+    template <std::ranges::forward_range range_type>
+    //!\cond
+        requires (std::convertible_to<std::ranges::range_value_t<range_type>, std::filesystem::path const &>
+                 && !std::convertible_to<range_type, std::filesystem::path const &>)
+    //!\endcond
+    void operator()(range_type const & v) const
+    {
+        validate_all(v);
+    }
+
     //!\brief Returns a message that can be appended to the (positional) options help page info.
     std::string get_help_page_message() const
     {
@@ -773,7 +1399,8 @@ public:
  *
  * The class acts as a functor that throws a sharg::validation_error exception whenever a given path
  * (std::filesystem::path) is not writable. This can happen if either the parent path does not exists, or the
- * path doesn't have the proper write permissions.
+ * path doesn't have the proper write permissions. The permissions are checked without creating the directory or a
+ * file in it.
  *
  * \include test/snippet/validators_output_directory.cpp
  *
@@ -811,25 +1438,24 @@ public:
      */
     virtual void operator()(std::filesystem::path const & dir) const override
     {
-        bool dir_exists = std::filesystem::exists(dir);
-        // Make sure the created dir is deleted after we are done.
-        std::error_code ec;
-        std::filesystem::create_directory(dir, ec); // does nothing and is not treated as error if path already exists.
-        // if error code was set or if dummy.txt could not be created within the output dir, throw an error.
-        if (static_cast<bool>(ec))
-            throw validation_error{"Cannot create directory: \"" + dir.string() + "\"!"};
-
         try
         {
-            if (!dir_exists)
+            detail::file_status const status = detail::file_status_cache::status(dir);
+
+            // A missing directory must be creatable, an existing one must allow to create files in it.
+            // Neither the directory nor a file in it is created to check this.
+            if (!status.exists())
+            {
+                if (!parent_is_writable(dir))
+                    throw validation_error{"Cannot create directory: \"" + dir.string() + "\"!"};
+            }
+            else if (status.type != detail::file_status::file_type::directory)
             {
-                sharg::detail::safe_filesystem_entry dir_guard{dir};
-                validate_writeability(dir / "dummy.txt");
-                dir_guard.remove_all();
+                throw validation_error{"Cannot create directory: \"" + dir.string() + "\"!"};
             }
-            else
+            else if (!detail::file_status_cache::writable(dir, true))
             {
-                validate_writeability(dir / "dummy.txt");
+                throw validation_error{"Cannot write \"" + dir.string() + "\"!"};
             }
         }
         // LCOV_EXCL_START
@@ -851,6 +1477,15 @@ public:
     }
 };
 
+//!\brief The engine that sharg::regex_validator uses to match a pattern.
+enum class regex_engine
+{
+    //!\brief Match with std::regex (full ECMAScript syntax).
+    std_regex,
+    //!\brief Match with a deterministic finite automaton (linear time, see sharg::detail::regex_dfa for the syntax).
+    dfa
+};
+
 /*!\brief A validator that checks if a matches a regular expression pattern.
  * \ingroup parser
  * \implements sharg::validator
@@ -858,7 +1493,7 @@ public:
  * \details
  *
  * On construction, the validator must receive a pattern for a regular expression.
- * The pattern variable will be used for constructing a std::regex and the
+ * The pattern is compiled once on construction (copies of the validator share the compiled pattern) and the
  * validator will call std::regex_match on the command line argument.
  * Note: A regex_match will only return true if the strings matches the pattern
  * completely (in contrast to regex_search which also matches substrings).
@@ -868,6 +1503,14 @@ public:
  *
  * \include test/snippet/validators_4.cpp
  *
+ * With sharg::regex_engine::dfa, the pattern is compiled to a deterministic finite automaton instead
+ * (see sharg::detail::regex_dfa for the supported syntax). Every value is then checked in linear time without
+ * backtracking, which pays off when validating long lists of values, e.g. identifiers:
+ *
+ * ```cpp
+ * sharg::regex_validator id_validator{"[A-Z]{2}[0-9]{6}(\\.[0-9]+)?", sharg::regex_engine::dfa};
+ * ```
+ *
  * \remark For a complete overview, take a look at \ref parser
  */
 class regex_validator
@@ -876,12 +1519,29 @@ public:
     //!\brief Type of values that are tested by validator.
     using option_value_type = std::string;
 
-    /*!\brief Constructing from a vector.
+    /*!\brief Constructing from a pattern.
      * \param[in] pattern_ The pattern to match.
+     * \param[in] engine   The engine that matches the pattern (default: sharg::regex_engine::std_regex).
+     * \throws sharg::design_error if the pattern is invalid or, for sharg::regex_engine::dfa, not supported.
      */
-    regex_validator(std::string const & pattern_) :
+    regex_validator(std::string const & pattern_, regex_engine const engine = regex_engine::std_regex) :
         pattern{pattern_}
-    {}
+    {
+        if (engine == regex_engine::dfa)
+        {
+            dfa = std::make_shared<detail::regex_dfa const>(pattern);
+            return;
+        }
+
+        try
+        {
+            rgx = std::make_shared<std::regex const>(pattern);
+        }
+        catch (std::regex_error const & error)
+        {
+            throw design_error{"The pattern '" + pattern + "' is not a valid regular expression: " + error.what()};
+        }
+    }
 
     /*!\brief Tests whether cmp lies inside values.
      * \param[in] cmp The value to validate.
@@ -889,8 +1549,9 @@ public:
      */
     void operator()(option_value_type const & cmp) const
     {
-        std::regex rgx(pattern);
-        if (!std::regex_match(cmp, rgx))
+        bool const matches = (dfa != nullptr) ? dfa->match(cmp) : std::regex_match(cmp, *rgx);
+
+        if (!matches)
             throw validation_error{"Value " + cmp + " did not match the pattern " + pattern + "."};
     }
 
@@ -922,6 +1583,10 @@ public:
 private:
     //!\brief The pattern to match.
     std::string pattern;
+    //!\brief The compiled pattern if sharg::regex_engine::std_regex is used; shared by all copies.
+    std::shared_ptr<std::regex const> rgx{};
+    //!\brief The automaton if sharg::regex_engine::dfa is used; shared by all copies.
+    std::shared_ptr<detail::regex_dfa const> dfa{};
 };
 
 namespace detail
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sharg/parser.hpp>
+
+// 100'000 random numbers as positional arguments.
+template <typename value_t>
+struct command_line
+{
+    static constexpr size_t count{100'000};
+
+    command_line()
+    {
+        std::mt19937_64 random_engine{42};
+        std::uniform_real_distribution<double> distribution{0, 1'000'000};
+
+        arguments.push_back("./benchmark");
+        arguments.push_back("--");
+        for (size_t i = 0; i < count; ++i)
+            arguments.push_back(std::to_string(static_cast<value_t>(distribution(random_engine))));
+
+        for (std::string const & argument : arguments)
+            argv.push_back(argument.c_str());
+    }
+
+    std::vector<std::string> arguments{};
+    std::vector<char const *> argv{};
+};
+
+template <typename value_t>
+void parse_list(benchmark::State & state)
+{
+    static command_line<value_t> const input{};
+    bool const with_validator = state.range(0);
+
+    for (auto _ : state)
+    {
+        std::vector<value_t> values{};
+        sharg::parser parser{"benchmark", static_cast<int>(input.argv.size()), input.argv.data(),
+                             sharg::update_notifications::off};
+
+        if (with_validator)
+            parser.add_positional_option(values, "desc", sharg::arithmetic_range_validator<value_t>{0, 1'000'000});
+        else
+            parser.add_positional_option(values, "desc");
+
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * command_line<value_t>::count);
+}
+
+BENCHMARK_TEMPLATE(parse_list, uint32_t)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(parse_list, double)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <sharg/parser.hpp>
+
+// 50'000 values of a list option, either as `-i 0 -i 1 ...` or as `--ids=0,1,...`.
+struct command_line
+{
+    static constexpr size_t count{50'000};
+
+    explicit command_line(bool const delimited)
+    {
+        arguments.push_back("./benchmark");
+
+        if (delimited)
+        {
+            std::string ids{"--ids=0"};
+            for (size_t i = 1; i < count; ++i)
+                ids += ',' + std::to_string(i);
+            arguments.push_back(std::move(ids));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                arguments.push_back("-i");
+                arguments.push_back(std::to_string(i));
+            }
+        }
+
+        for (std::string const & argument : arguments)
+            argv.push_back(argument.c_str());
+    }
+
+    std::vector<std::string> arguments{};
+    std::vector<char const *> argv{};
+};
+
+void parse_list_option(benchmark::State & state)
+{
+    bool const delimited = state.range(0);
+    static command_line const repeated_input{false};
+    static command_line const delimited_input{true};
+    command_line const & input = delimited ? delimited_input : repeated_input;
+
+    for (auto _ : state)
+    {
+        std::vector<uint32_t> values{};
+        sharg::parser parser{"benchmark", static_cast<int>(input.argv.size()), input.argv.data(),
+                             sharg::update_notifications::off};
+        parser.add_option(values, 'i', "ids", "desc");
+        parser.set_list_delimiter('i', ',');
+
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * command_line::count);
+}
+
+BENCHMARK(parse_list_option)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
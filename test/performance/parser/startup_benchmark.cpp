@@ -0,0 +1,78 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <sharg/parser.hpp>
+
+// A git-like tool with 20 subcommands: `./tool remote -v --name origin --url https://...`.
+std::vector<std::string> const subcommands{"add",   "bisect", "branch", "checkout", "clone",  "commit", "diff",
+                                           "fetch", "grep",   "init",   "log",      "merge",  "mv",     "pull",
+                                           "push",  "rebase", "remote", "reset",    "restore", "status"};
+
+std::vector<char const *> const argv{"./tool", "remote", "-v", "--name", "origin", "--url", "https://example.org"};
+
+// Constructs the parser and the sub-parser, adds the options of the subcommand and parses the command line.
+void git_like_startup(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        sharg::parser top_level{"tool", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off,
+                                subcommands};
+        top_level.parse();
+
+        sharg::parser & sub_parser = top_level.get_sub_parser();
+        bool verbose{false};
+        std::string name{};
+        std::string url{};
+        sub_parser.add_flag(verbose, 'v', "verbose", "Be verbose.");
+        sub_parser.add_option(name, 'n', "name", "The name of the remote.");
+        sub_parser.add_option(url, 'u', "url", "The url of the remote.");
+        sub_parser.parse();
+
+        benchmark::DoNotOptimize(url.data());
+    }
+}
+
+// The previous check of the application and subcommand names: one std::regex per parser.
+void app_names_std_regex(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        std::regex const app_name_regex{"^[a-zA-Z0-9_-]+$"};
+        bool valid = std::regex_match(std::string{"tool"}, app_name_regex);
+
+        for (std::string const & subcommand : subcommands)
+            valid &= std::regex_match(subcommand, app_name_regex);
+
+        benchmark::DoNotOptimize(valid);
+    }
+}
+
+// The current check with a table of character classes.
+void app_names_char_class(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        bool valid = sharg::detail::is_valid_app_name("tool");
+
+        for (std::string const & subcommand : subcommands)
+            valid &= sharg::detail::is_valid_app_name(subcommand);
+
+        benchmark::DoNotOptimize(valid);
+    }
+}
+
+BENCHMARK(git_like_startup);
+BENCHMARK(app_names_std_regex);
+BENCHMARK(app_names_char_class);
+
+BENCHMARK_MAIN();
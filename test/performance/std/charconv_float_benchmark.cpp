@@ -0,0 +1,121 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sharg/std/charconv>
+
+// The inputs of test/unit/std/charconv_float_test.cpp.
+std::vector<std::string> const inputs{"1234", "1.2e3", "1.2e-3", "1.e2", "1.", ".2e3", "2e3", "2", "-1.2e3", "-.3",
+                                      "0.0", "3.194357", "120.25", "inf", "nan"};
+
+std::vector<double> const values{1234, 1200, 0.0012, 100, 1, 200, 2000, 2, -1200, -0.3, 0, 3.194357, 120.25,
+                                 0.1 + 0.2, 1e-300};
+
+// The previous fallback: strtod on a copy of the input and std::ostringstream.
+struct legacy
+{
+    static std::from_chars_result from_chars(char const * first, char const * last, double & value) noexcept
+    {
+        char buffer[100];
+        std::copy(first, std::min(last, first + 99), buffer);
+        buffer[std::min<ptrdiff_t>(99, last - first)] = '\0';
+        char * end;
+        value = std::strtod(buffer, &end);
+        return {first + (end - buffer), std::errc{}};
+    }
+
+    static std::to_chars_result to_chars(char * first, char * last, double const value)
+    {
+        std::ostringstream stream;
+        stream << value;
+        std::string const str = stream.str();
+
+        if (last - first < static_cast<std::ptrdiff_t>(str.size()))
+            return {last, std::errc::value_too_large};
+
+        return {std::copy(str.begin(), str.end(), first), std::errc{}};
+    }
+};
+
+struct shim
+{
+    static std::from_chars_result from_chars(char const * first, char const * last, double & value) noexcept
+    {
+        return sharg::contrib::charconv_float::from_chars_floating_point(first, last, value);
+    }
+
+    static std::to_chars_result to_chars(char * first, char * last, double const value) noexcept
+    {
+        return sharg::contrib::charconv_float::to_chars_floating_point(first, last, value);
+    }
+};
+
+#if __cpp_lib_to_chars >= 201611
+struct standard_library
+{
+    static std::from_chars_result from_chars(char const * first, char const * last, double & value) noexcept
+    {
+        return std::from_chars(first, last, value);
+    }
+
+    static std::to_chars_result to_chars(char * first, char * last, double const value) noexcept
+    {
+        return std::to_chars(first, last, value);
+    }
+};
+#endif
+
+template <typename implementation_t>
+void from_chars_double(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        for (std::string const & input : inputs)
+        {
+            double value{};
+            implementation_t::from_chars(input.data(), input.data() + input.size(), value);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+template <typename implementation_t>
+void to_chars_double(benchmark::State & state)
+{
+    char buffer[64];
+
+    for (auto _ : state)
+    {
+        for (double const value : values)
+        {
+            auto res = implementation_t::to_chars(buffer, buffer + sizeof(buffer), value);
+            benchmark::DoNotOptimize(res.ptr);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK_TEMPLATE(from_chars_double, legacy);
+BENCHMARK_TEMPLATE(from_chars_double, shim);
+BENCHMARK_TEMPLATE(to_chars_double, legacy);
+BENCHMARK_TEMPLATE(to_chars_double, shim);
+
+#if __cpp_lib_to_chars >= 201611
+BENCHMARK_TEMPLATE(from_chars_double, standard_library);
+BENCHMARK_TEMPLATE(to_chars_double, standard_library);
+#endif
+
+BENCHMARK_MAIN();
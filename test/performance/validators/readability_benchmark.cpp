@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <vector>
+
+#include <sharg/test/tmp_filename.hpp>
+#include <sharg/validators.hpp>
+
+// 10'000 empty files in a temporary directory, created once.
+struct input_files
+{
+    static constexpr size_t count{10'000};
+
+    input_files()
+    {
+        std::filesystem::create_directory(directory.get_path());
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            paths.push_back(directory.get_path() / ("file" + std::to_string(i) + ".fa"));
+            std::ofstream{paths.back()};
+        }
+    }
+
+    ~input_files()
+    {
+        std::filesystem::remove_all(directory.get_path());
+    }
+
+    sharg::test::tmp_filename directory{"readability_benchmark"};
+    std::vector<std::filesystem::path> paths{};
+};
+
+input_files const & files()
+{
+    static input_files const instance{};
+    return instance;
+}
+
+// The previous check: open every file with a stream.
+void readability_ifstream(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        for (std::filesystem::path const & path : files().paths)
+        {
+            std::ifstream file{path};
+            benchmark::DoNotOptimize(file.is_open() && file.good());
+        }
+    }
+
+    state.counters["files/s"] = benchmark::Counter(input_files::count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// The current check: one faccessat call per file.
+void readability_access(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        for (std::filesystem::path const & path : files().paths)
+            benchmark::DoNotOptimize(sharg::detail::file_status::readable(path));
+    }
+
+    state.counters["files/s"] = benchmark::Counter(input_files::count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// The whole input file validator on the list of files (metadata, readability and extension).
+void input_file_validator_list(benchmark::State & state)
+{
+    sharg::input_file_validator const validator{std::vector<std::string>{"fa"}};
+
+    for (auto _ : state)
+        validator(files().paths);
+
+    state.counters["files/s"] = benchmark::Counter(input_files::count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(readability_ifstream);
+BENCHMARK(readability_access);
+BENCHMARK(input_file_validator_list);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,43 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <sharg/all.hpp>
+
+// Validates the command lines of a manifest (one call of "penguin_parade" per line), e.g.
+// ./batch_validation_snippet manifest.txt
+// Without an argument, a small example manifest is validated.
+int main(int argc, char ** argv)
+{
+    int day{1};
+    int month{1};
+    std::vector<std::string> penguin_names{};
+
+    sharg::parser_schema schema{"penguin_parade"};
+    schema.add_option(day, 'd', "day", "Please specify your preferred day.", sharg::option_spec::standard,
+                      sharg::arithmetic_range_validator{1, 31});
+    schema.add_option(month, 'm', "month", "Please specify your preferred month.", sharg::option_spec::standard,
+                      sharg::arithmetic_range_validator{1, 12});
+    schema.add_positional_option(penguin_names, "Specify the names of the penguins.");
+
+    std::istringstream example{"penguin_parade -d 10 -m 02 Skipper Kowalski\n"
+                               "penguin_parade -d 32 Rico\n"
+                               "penguin_parade --month=3 'Private Penguin'\n"
+                               "penguin_parade -y 2017 Skipper\n"};
+    std::ifstream manifest_file{};
+
+    if (argc > 1)
+        manifest_file.open(argv[1]);
+
+    std::istream & manifest = (argc > 1) ? static_cast<std::istream &>(manifest_file) : example;
+
+    sharg::batch_validation_summary summary =
+        sharg::validate_batch(schema, manifest, [] (size_t line_number, std::string_view, sharg::parse_result const & r)
+    {
+        if (!r)
+            std::cout << "Line " << line_number << ": " << r.message() << '\n';
+    });
+
+    std::cout << summary.invalid_command_lines << " of " << summary.command_lines << " command lines are invalid.\n";
+    return 0;
+}
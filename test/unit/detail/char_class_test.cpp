@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <string>
+
+#include <sharg/detail/char_class.hpp>
+
+TEST(char_class, is_char_of)
+{
+    EXPECT_TRUE(sharg::detail::is_char_of('7', sharg::detail::digit_char));
+    EXPECT_FALSE(sharg::detail::is_char_of('a', sharg::detail::digit_char));
+    EXPECT_TRUE(sharg::detail::is_char_of('Z', sharg::detail::short_id_chars));
+    EXPECT_TRUE(sharg::detail::is_char_of('@', sharg::detail::short_id_chars));
+    EXPECT_FALSE(sharg::detail::is_char_of('-', sharg::detail::short_id_chars));
+    EXPECT_TRUE(sharg::detail::is_char_of('-', sharg::detail::long_id_chars));
+    EXPECT_FALSE(sharg::detail::is_char_of('@', sharg::detail::app_name_chars));
+    EXPECT_FALSE(sharg::detail::is_char_of('\xE4', sharg::detail::long_id_chars));
+    EXPECT_FALSE(sharg::detail::is_char_of('\0', sharg::detail::long_id_chars));
+}
+
+TEST(char_class, is_valid_app_name)
+{
+    static_assert(sharg::detail::is_valid_app_name("my_app-2"));
+    static_assert(!sharg::detail::is_valid_app_name(""));
+
+    // same result as the regex that is documented for application names
+    std::regex const app_name_regex{"^[a-zA-Z0-9_-]+$"};
+
+    for (int c = 0; c < 256; ++c)
+    {
+        std::string const name{'a', static_cast<char>(c), 'z'};
+        EXPECT_EQ(sharg::detail::is_valid_app_name(name), std::regex_match(name, app_name_regex)) << c;
+    }
+
+    for (std::string name : {"", "-", "app name", "app/name", "äpp", "app\n", "APP_name-01"})
+        EXPECT_EQ(sharg::detail::is_valid_app_name(name), std::regex_match(name, app_name_regex)) << name;
+}
+
+TEST(char_class, version_prefix_length)
+{
+    static_assert(sharg::detail::version_prefix_length("1.2.3") == 5u);
+
+    EXPECT_EQ(sharg::detail::version_prefix_length("3.0.12"), 6u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("3.0.12-rc.1"), 6u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("10.20.30.40"), 8u);
+    EXPECT_EQ(sharg::detail::version_prefix_length(""), 0u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("1.2"), 0u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("1.2."), 0u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("1..3"), 0u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("v1.2.3"), 0u);
+    EXPECT_EQ(sharg::detail::version_prefix_length("1.2.x"), 0u);
+}
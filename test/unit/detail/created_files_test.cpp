@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/created_files.hpp>
+
+using sharg::detail::created_files;
+
+TEST(created_files, without_instance)
+{
+    size_t removed{0};
+    EXPECT_EQ(created_files::current(), nullptr);
+    created_files::add([&removed] () { ++removed; });
+    EXPECT_EQ(removed, 0u); // nothing is registered
+}
+
+TEST(created_files, removed_unless_committed)
+{
+    size_t removed{0};
+    {
+        created_files files{};
+        created_files::scope const use_files{&files};
+        created_files::add([&removed] () { ++removed; });
+        created_files::add([&removed] () { ++removed; });
+        EXPECT_EQ(removed, 0u);
+    }
+    EXPECT_EQ(removed, 2u);
+
+    {
+        created_files files{};
+        created_files::scope const use_files{&files};
+        created_files::add([&removed] () { ++removed; });
+        files.commit();
+    }
+    EXPECT_EQ(removed, 2u);
+}
+
+TEST(created_files, scopes_nest)
+{
+    created_files outer{};
+    created_files inner{};
+    {
+        created_files::scope const use_outer{&outer};
+        {
+            created_files::scope const use_inner{&inner};
+            EXPECT_EQ(created_files::current(), &inner);
+        }
+        EXPECT_EQ(created_files::current(), &outer);
+    }
+    EXPECT_EQ(created_files::current(), nullptr);
+}
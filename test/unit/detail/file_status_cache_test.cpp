@@ -0,0 +1,144 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sharg/detail/file_status_cache.hpp>
+#include <sharg/parser.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+using sharg::detail::file_status_cache;
+
+TEST(file_status_cache, without_cache)
+{
+    sharg::test::tmp_filename tmp{"file.txt"};
+    EXPECT_EQ(file_status_cache::current(), nullptr);
+    EXPECT_FALSE(file_status_cache::status(tmp.get_path()).exists());
+
+    std::ofstream{tmp.get_path()};
+    EXPECT_TRUE(file_status_cache::status(tmp.get_path()).exists()); // every call queries the file system
+    EXPECT_TRUE(file_status_cache::readable(tmp.get_path()));
+}
+
+TEST(file_status_cache, results_are_cached)
+{
+    sharg::test::tmp_filename tmp{"file.txt"};
+    std::filesystem::path const path{tmp.get_path()};
+
+    file_status_cache cache{};
+    file_status_cache::scope const use_cache{&cache};
+
+    EXPECT_FALSE(file_status_cache::status(path).exists());
+    EXPECT_FALSE(file_status_cache::readable(path));
+
+    std::ofstream{path};
+
+    // the cache is not invalidated implicitly
+    EXPECT_FALSE(file_status_cache::status(path).exists());
+    EXPECT_FALSE(file_status_cache::readable(path));
+    EXPECT_EQ(cache.size(), 1u);
+
+    // paths are not normalised
+    EXPECT_TRUE(file_status_cache::status(path.parent_path() / "." / path.filename()).exists());
+    EXPECT_EQ(cache.size(), 2u);
+    file_status_cache::invalidate(path.parent_path() / "." / path.filename());
+
+    file_status_cache::invalidate(path);
+    EXPECT_TRUE(file_status_cache::status(path).exists());
+    EXPECT_TRUE(file_status_cache::readable(path));
+    EXPECT_TRUE(file_status_cache::writable(path));
+
+    std::filesystem::remove(path);
+    EXPECT_TRUE(file_status_cache::status(path).exists());
+
+    file_status_cache::invalidate_all();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_FALSE(file_status_cache::status(path).exists());
+}
+
+TEST(file_status_cache, scopes_nest)
+{
+    file_status_cache outer{};
+    file_status_cache inner{};
+    {
+        file_status_cache::scope const use_outer{&outer};
+        {
+            file_status_cache::scope const use_inner{&inner};
+            EXPECT_EQ(file_status_cache::current(), &inner);
+        }
+        EXPECT_EQ(file_status_cache::current(), &outer);
+    }
+    EXPECT_EQ(file_status_cache::current(), nullptr);
+}
+
+TEST(file_status_cache, one_cache_per_parse)
+{
+    sharg::test::tmp_filename tmp{"file.txt"};
+    std::ofstream{tmp.get_path()};
+    std::string const path = tmp.get_path().string();
+
+    std::vector<file_status_cache *> caches{};
+    auto remember_cache = [&caches] (std::string const &)
+    {
+        caches.push_back(file_status_cache::current());
+    };
+    struct remembering_validator
+    {
+        using option_value_type = std::string;
+        std::function<void(std::string const &)> callback;
+        void operator()(std::string const & value) const { callback(value); }
+        std::string get_help_page_message() const { return ""; }
+    };
+
+    std::filesystem::path input{};
+    std::filesystem::path input_again{};
+    char const * argv[] = {"./parser_test", "-i", path.c_str(), "-j", path.c_str()};
+    sharg::parser parser{"test_parser", 5, argv, sharg::update_notifications::off};
+    parser.add_option(input, 'i', "input", "desc", sharg::option_spec::standard,
+                      sharg::input_file_validator{} | remembering_validator{remember_cache});
+    parser.add_option(input_again, 'j', "input-again", "desc", sharg::option_spec::standard,
+                      sharg::input_file_validator{} | remembering_validator{remember_cache});
+
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_EQ(caches.size(), 2u);
+    EXPECT_NE(caches[0], nullptr);
+    EXPECT_EQ(caches[0], caches[1]);
+    EXPECT_EQ(file_status_cache::current(), nullptr); // removed after the parse
+}
+
+TEST(file_status_cache, symbolic_link_followed_by_parent_directory)
+{
+    // l/../f.txt is a/f.txt (which does not exist) and not f.txt
+    sharg::test::tmp_filename tmp{"dir"};
+    std::filesystem::path const dir{tmp.get_path()};
+    std::filesystem::create_directories(dir / "a" / "b");
+    std::filesystem::create_directory_symlink(dir / "a" / "b", dir / "l");
+    std::ofstream{dir / "f.txt"};
+
+    std::string const file = (dir / "f.txt").string();
+    std::string const through_link = (dir / "l" / ".." / "f.txt").string();
+
+    auto validate = [] (std::string const & first, std::string const & second)
+    {
+        std::vector<std::filesystem::path> files{};
+        char const * argv[] = {"./parser_test", first.c_str(), second.c_str()};
+        sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+        parser.add_positional_option(files, "desc", sharg::input_file_validator{});
+        return parser.try_parse();
+    };
+
+    sharg::parse_result result = validate(file, through_link);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_NE(result.message().find(through_link), std::string::npos);
+
+    result = validate(through_link, file);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_NE(result.message().find(through_link), std::string::npos);
+    EXPECT_EQ(result.message().find(file), std::string::npos); // f.txt is accepted
+}
@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sharg/detail/file_status.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+using file_type = sharg::detail::file_status::file_type;
+
+TEST(file_status, regular_file)
+{
+    sharg::test::tmp_filename tmp{"file.txt"};
+    std::ofstream{tmp.get_path()} << "12345";
+
+    sharg::detail::file_status const status = sharg::detail::file_status::query(tmp.get_path());
+    EXPECT_TRUE(status.exists());
+    EXPECT_EQ(status.type, file_type::regular);
+    EXPECT_EQ(status.size, 5u);
+    EXPECT_NE(status.inode, 0u);
+}
+
+TEST(file_status, directory)
+{
+    sharg::test::tmp_filename tmp{"dir"};
+    std::filesystem::create_directory(tmp.get_path());
+
+    sharg::detail::file_status const status = sharg::detail::file_status::query(tmp.get_path());
+    EXPECT_EQ(status.type, file_type::directory);
+}
+
+TEST(file_status, not_found)
+{
+    sharg::test::tmp_filename tmp{"missing.txt"};
+
+    EXPECT_FALSE(sharg::detail::file_status::query(tmp.get_path()).exists());
+    EXPECT_FALSE(sharg::detail::file_status::query(tmp.get_path() / "below_missing").exists());
+}
+
+TEST(file_status, same_file)
+{
+    sharg::test::tmp_filename tmp{"file.txt"};
+    std::ofstream{tmp.get_path()};
+    std::filesystem::create_symlink(tmp.get_path(), tmp.get_path().string() + ".link");
+
+    sharg::detail::file_status const status = sharg::detail::file_status::query(tmp.get_path());
+    sharg::detail::file_status const link_status = sharg::detail::file_status::query(tmp.get_path().string() + ".link");
+    EXPECT_EQ(link_status.type, file_type::regular); // links are followed
+    EXPECT_EQ(status.device, link_status.device);
+    EXPECT_EQ(status.inode, link_status.inode);
+
+    std::filesystem::remove(tmp.get_path().string() + ".link");
+}
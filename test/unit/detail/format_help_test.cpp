@@ -290,6 +290,28 @@ TEST(help_page_printing, do_not_print_hidden_options)
     EXPECT_EQ(std_cout, expected);
 }
 
+TEST(help_page_printing, positional_option_sink)
+{
+    sharg::parser parser{"test_parser", 2, argv1};
+    sharg::detail::test_accessor::set_terminal_width(parser, 80);
+    parser.add_positional_option<int>([] (int) {}, "this is a positional sink.",
+                                      sharg::arithmetic_range_validator{1, 5});
+    testing::internal::CaptureStdout();
+    EXPECT_EXIT(parser.parse(), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+    std_cout = testing::internal::GetCapturedStdout();
+    expected = "test_parser\n"
+               "===========\n"
+               "\n"
+               "POSITIONAL ARGUMENTS\n"
+               "    ARGUMENT-1 (List of signed 32 bit integer)\n"
+               "          this is a positional sink. Value must be in range [1,5].\n"
+               "\n" +
+               basic_options_str +
+               "\n" +
+               basic_version_str;
+    EXPECT_EQ(std_cout, expected);
+}
+
 TEST(help_page_printing, advanced_options)
 {
     int32_t option_value{5};
@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include <sharg/detail/from_chars_integer.hpp>
+
+template <typename t>
+class from_chars_integer_test : public ::testing::Test
+{};
+
+using integer_types = ::testing::Types<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t>;
+TYPED_TEST_SUITE(from_chars_integer_test, integer_types, );
+
+// compares the result and the value to std::from_chars
+template <typename value_t>
+void expect_same_as_std(std::string const & input)
+{
+    value_t expected{42};
+    value_t actual{42};
+    std::from_chars_result const expected_result = std::from_chars(input.data(), input.data() + input.size(), expected);
+    std::from_chars_result const actual_result =
+        sharg::detail::from_chars_integer(input.data(), input.data() + input.size(), actual);
+
+    EXPECT_EQ(actual_result.ec, expected_result.ec) << input;
+    EXPECT_EQ(actual_result.ptr, expected_result.ptr) << input;
+    EXPECT_EQ(actual, expected) << input;
+}
+
+TEST(from_chars_integer, eight_digits)
+{
+    EXPECT_TRUE(sharg::detail::is_eight_digits(0x3031323334353639));
+    EXPECT_FALSE(sharg::detail::is_eight_digits(0x303132333435363A)); // ':'
+    EXPECT_FALSE(sharg::detail::is_eight_digits(0x303132332F353637)); // '/'
+    EXPECT_FALSE(sharg::detail::is_eight_digits(0x3031323320353637)); // ' '
+
+    uint64_t chunk;
+    std::memcpy(&chunk, "12345678", 8);
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        EXPECT_EQ(sharg::detail::parse_eight_digits(chunk), 12345678u);
+    }
+}
+
+TYPED_TEST(from_chars_integer_test, edge_cases)
+{
+    using limits = std::numeric_limits<TypeParam>;
+
+    for (std::string const & input : {std::string{""}, std::string{"-"}, std::string{"0"}, std::string{"-0"},
+                                    std::string{"+1"}, std::string{" 1"}, std::string{"1 "}, std::string{"12a"},
+                                    std::string{"00000000000000000000000042"}, std::string{"123456781234567812"},
+                                    std::to_string(limits::max()), std::to_string(limits::min()),
+                                    std::to_string(limits::max()) + "0", std::to_string(limits::min()) + "0",
+                                    std::string{"18446744073709551616"}, std::string{"-9223372036854775809"},
+                                    std::string{"9999999999999999999"}})
+    {
+        expect_same_as_std<TypeParam>(input);
+    }
+}
+
+TYPED_TEST(from_chars_integer_test, random)
+{
+    std::mt19937_64 random_engine{42};
+    std::string_view const alphabet{"0123456789-+a "};
+
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        std::string input{};
+        bool const digits_only = random_engine() % 2;
+
+        for (size_t length = random_engine() % 24; length > 0; --length)
+            input += digits_only ? static_cast<char>('0' + random_engine() % 10) : alphabet[random_engine() % 14];
+
+        if (random_engine() % 4 == 0)
+            input.insert(input.begin(), '-');
+
+        expect_same_as_std<TypeParam>(input);
+    }
+}
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <regex>
+
+#include <sharg/detail/regex_dfa.hpp>
+
+// compares the automaton with std::regex_match
+void expect_same_as_std_regex(std::string const & pattern, std::vector<std::string> const & inputs)
+{
+    sharg::detail::regex_dfa const dfa{pattern};
+    std::regex const rgx{pattern};
+
+    for (std::string const & input : inputs)
+        EXPECT_EQ(dfa.match(input), std::regex_match(input, rgx)) << "pattern: " << pattern << " input: " << input;
+}
+
+TEST(regex_dfa, literals)
+{
+    expect_same_as_std_regex("tt", {"", "t", "tt", "ttt", "at"});
+    expect_same_as_std_regex("", {"", "a"});
+    expect_same_as_std_regex("a\\.b\\\\c", {"a.b\\c", "axb\\c", "a.bc"});
+    expect_same_as_std_regex("\\t\\n", {"\t\n", "tn"});
+}
+
+TEST(regex_dfa, character_classes)
+{
+    expect_same_as_std_regex("[0-9]", {"0", "5", "9", "a", "", "12"});
+    expect_same_as_std_regex("[^/]+", {"abc", "a/c", "", "/"});
+    expect_same_as_std_regex("[a-zA-Z_-]*", {"ab_C-d", "ab1", "", "-"});
+    expect_same_as_std_regex("[\\d.]+", {"1.5", "a", "..."});
+    expect_same_as_std_regex("\\d\\D\\w\\W\\s\\S", {"1a_ \tx", "1aa  x", "a1_ \tx"});
+    expect_same_as_std_regex(".+", {"abc", "a\nb", "", "a\rb"});
+}
+
+TEST(regex_dfa, groups_and_alternatives)
+{
+    expect_same_as_std_regex("(ab|cd)+", {"ab", "abcd", "cdab", "", "abc", "ac"});
+    expect_same_as_std_regex("(?:a|b)c|d", {"ac", "bc", "d", "c", "ad"});
+    expect_same_as_std_regex("a|", {"a", "", "b"});
+    expect_same_as_std_regex("((a)|(b(c)))*", {"", "abcab", "acb"});
+}
+
+TEST(regex_dfa, quantifiers)
+{
+    expect_same_as_std_regex("a*b+c?", {"b", "aabbc", "abcc", "", "ac"});
+    expect_same_as_std_regex("a{3}", {"aa", "aaa", "aaaa"});
+    expect_same_as_std_regex("a{2,}", {"a", "aa", "aaaaaaa"});
+    expect_same_as_std_regex("a{1,3}b", {"b", "ab", "aaab", "aaaab"});
+    expect_same_as_std_regex("a{0}b", {"b", "ab"});
+    expect_same_as_std_regex("a+?b*?", {"a", "aab", ""});
+    expect_same_as_std_regex("(a*)*", {"", "aaa", "b"});
+}
+
+TEST(regex_dfa, anchors)
+{
+    expect_same_as_std_regex("^chr[0-9]+", {"chr1", "chr12", "chr", "xchr1"});
+    expect_same_as_std_regex("(/[^/]+)+/.*\\.[^/\\.]+$", {"/a/b/c.txt", "/a/b", "a/b.txt", "/a/.txt", "/a/b.c/d"});
+}
+
+TEST(regex_dfa, repository_patterns)
+{
+    expect_same_as_std_regex("[a-zA-Z]+@[a-zA-Z]+\\.com", {"rollo@gmail.com", "lilli@lala.com", "x@y.de", "@a.com"});
+    expect_same_as_std_regex(".*oll.*", {"rollo", "bttllo", "lollo", "oll"});
+    expect_same_as_std_regex("[A-Z]{2}[0-9]{6}(\\.[0-9]+)?", {"AB123456", "AB123456.1", "AB12345", "AB123456."});
+}
+
+TEST(regex_dfa, unsupported_patterns)
+{
+    EXPECT_THROW(sharg::detail::regex_dfa{"(a)\\1"}, sharg::design_error);   // back reference
+    EXPECT_THROW(sharg::detail::regex_dfa{"a\\b"}, sharg::design_error);     // word boundary
+    EXPECT_THROW(sharg::detail::regex_dfa{"(?=a)a"}, sharg::design_error);   // look ahead
+    EXPECT_THROW(sharg::detail::regex_dfa{"[[:alpha:]]"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"a^b"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"a$b"}, sharg::design_error);
+}
+
+TEST(regex_dfa, invalid_patterns)
+{
+    EXPECT_THROW(sharg::detail::regex_dfa{"(a"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"a)"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"[a"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"[z-a]"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"*a"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"a{2,1}"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"a{"}, sharg::design_error);
+    EXPECT_THROW(sharg::detail::regex_dfa{"a\\"}, sharg::design_error);
+}
+
+TEST(regex_dfa, too_many_states)
+{
+    // (a|b)*a(a|b){n} needs 2^(n+1) states
+    EXPECT_NO_THROW(sharg::detail::regex_dfa{"(a|b)*a(a|b){8}"});
+    EXPECT_THROW(sharg::detail::regex_dfa{"(a|b)*a(a|b){20}"}, sharg::design_error);
+}
+
+TEST(regex_dfa, long_input)
+{
+    sharg::detail::regex_dfa const dfa{"(a|aa)*b"};
+    std::string input(100000, 'a');
+    EXPECT_FALSE(dfa.match(input));
+    input.push_back('b');
+    EXPECT_TRUE(dfa.match(input));
+}
@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/shell_tokenizer.hpp>
+
+using arguments_t = std::vector<std::string_view>;
+
+arguments_t split(std::string_view const input, std::string & buffer)
+{
+    arguments_t arguments{};
+    EXPECT_TRUE(sharg::detail::split_command_line(input, buffer, arguments));
+    return arguments;
+}
+
+TEST(split_command_line, white_space)
+{
+    std::string buffer{};
+    EXPECT_EQ(split("", buffer), arguments_t{});
+    EXPECT_EQ(split(" \t\r\n", buffer), arguments_t{});
+    EXPECT_EQ(split("app -i 5  --name=foo\tbar\r", buffer), (arguments_t{"app", "-i", "5", "--name=foo", "bar"}));
+    EXPECT_EQ(split("app\n-i\n5\n", buffer), (arguments_t{"app", "-i", "5"}));
+}
+
+TEST(split_command_line, arguments_without_quotes_are_not_copied)
+{
+    std::string buffer{};
+    std::string_view const input{"app -i 5"};
+    arguments_t const arguments = split(input, buffer);
+
+    ASSERT_EQ(arguments.size(), 3u);
+    for (std::string_view const argument : arguments)
+        EXPECT_TRUE(argument.data() >= input.data() && argument.data() < input.data() + input.size());
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(split_command_line, quotes)
+{
+    std::string buffer{};
+    EXPECT_EQ(split("app 'a b' \"c d\"", buffer), (arguments_t{"app", "a b", "c d"}));
+    EXPECT_EQ(split("app --name='a b'c\"d e\"", buffer), (arguments_t{"app", "--name=a bcd e"}));
+    EXPECT_EQ(split("app '' \"\"", buffer), (arguments_t{"app", "", ""}));
+    EXPECT_EQ(split("app 'a\\\"b' \"a'b\"", buffer), (arguments_t{"app", "a\\\"b", "a'b"}));
+    EXPECT_EQ(split("app \"a\\\"b\\\\c\\d\\$\"", buffer), (arguments_t{"app", "a\"b\\c\\d$"}));
+}
+
+TEST(split_command_line, backslash)
+{
+    std::string buffer{};
+    EXPECT_EQ(split("app a\\ b \\'c\\\\", buffer), (arguments_t{"app", "a b", "'c\\"}));
+    EXPECT_EQ(split("app -i \\\n5", buffer), (arguments_t{"app", "-i", "5"}));
+
+    // a line continuation followed by indentation does not start an empty argument
+    EXPECT_EQ(split("a \\\n    b", buffer), (arguments_t{"a", "b"}));
+    EXPECT_EQ(split("a\\\n    b", buffer), (arguments_t{"a", "b"}));
+    EXPECT_EQ(split("app \\\n  -i 5 \\\n  -j 6 \\\n", buffer), (arguments_t{"app", "-i", "5", "-j", "6"}));
+    EXPECT_EQ(split("app '' \\\n  b", buffer), (arguments_t{"app", "", "b"}));
+    EXPECT_EQ(split("app \\\n\\\nb", buffer), (arguments_t{"app", "b"}));
+}
+
+TEST(split_command_line, comments)
+{
+    std::string buffer{};
+    EXPECT_EQ(split("# a comment", buffer), arguments_t{});
+    EXPECT_EQ(split("app -i 5 # a comment\n-j 6", buffer), (arguments_t{"app", "-i", "5", "-j", "6"}));
+    EXPECT_EQ(split("app a#b '#c'", buffer), (arguments_t{"app", "a#b", "#c"}));
+}
+
+TEST(split_command_line, errors)
+{
+    std::string buffer{};
+    arguments_t arguments{};
+    EXPECT_FALSE(sharg::detail::split_command_line("app 'a b", buffer, arguments));
+    EXPECT_FALSE(sharg::detail::split_command_line("app \"a b", buffer, arguments));
+    EXPECT_FALSE(sharg::detail::split_command_line("app \"a b\\\"", buffer, arguments));
+    EXPECT_FALSE(sharg::detail::split_command_line("app a\\", buffer, arguments));
+}
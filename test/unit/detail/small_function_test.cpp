@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include <sharg/detail/small_function.hpp>
+
+using function_t = sharg::detail::small_function<int(int)>;
+
+TEST(small_function, empty)
+{
+    function_t f{};
+    EXPECT_FALSE(f);
+
+    function_t g{f};
+    EXPECT_FALSE(g);
+}
+
+TEST(small_function, small_callable)
+{
+    int offset{3};
+    auto add = [offset] (int i) { return i + offset; };
+    EXPECT_TRUE(function_t::is_stored_in_place<decltype(add)>);
+
+    function_t f{add};
+    EXPECT_TRUE(f);
+    EXPECT_EQ(f(1), 4);
+
+    function_t copy{f};
+    EXPECT_EQ(copy(2), 5);
+
+    function_t moved{std::move(f)};
+    EXPECT_EQ(moved(3), 6);
+}
+
+TEST(small_function, large_callable)
+{
+    std::array<int, 100> values{};
+    values[10] = 42;
+    auto lookup = [values] (int i) { return values[i]; };
+    EXPECT_FALSE(function_t::is_stored_in_place<decltype(lookup)>);
+
+    function_t f{lookup};
+    EXPECT_EQ(f(10), 42);
+
+    function_t copy{};
+    copy = f;
+    EXPECT_EQ(copy(10), 42);
+
+    function_t moved{};
+    moved = std::move(f);
+    EXPECT_EQ(moved(10), 42);
+    EXPECT_EQ(copy(10), 42);
+}
+
+TEST(small_function, destroys_callable)
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        function_t f{[counter] (int i) { return i + *counter; }};
+        function_t copy{f};
+        EXPECT_EQ(counter.use_count(), 3);
+
+        function_t moved{std::move(f)};
+        EXPECT_EQ(counter.use_count(), 3);
+
+        copy = moved;
+        EXPECT_EQ(counter.use_count(), 3);
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(small_function, reference_arguments)
+{
+    sharg::detail::small_function<void(std::string &, std::string const &)> append
+    {
+        [] (std::string & target, std::string const & suffix) { target += suffix; }
+    };
+
+    std::string str{"foo"};
+    append(str, "bar");
+    EXPECT_EQ(str, "foobar");
+}
@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/special_arguments.hpp>
+
+using sharg::detail::special_format;
+
+TEST(special_arguments, no_special_arguments)
+{
+    sharg::detail::special_arguments result = sharg::detail::scan_special_arguments({"-i", "5", "pos"});
+
+    EXPECT_TRUE(result.error.success());
+    EXPECT_EQ(result.format, special_format::none);
+    EXPECT_FALSE(result.version_check.has_value());
+    EXPECT_EQ(result.remaining, (std::vector<std::string_view>{"-i", "5", "pos"}));
+    EXPECT_TRUE(result.removed_indices.empty());
+}
+
+TEST(special_arguments, formats)
+{
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"-h"}).format, special_format::help);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--help"}).format, special_format::help);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"-hh"}).format, special_format::advanced_help);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--advanced-help"}).format, special_format::advanced_help);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--version"}).format, special_format::version);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--copyright"}).format, special_format::copyright);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--export-help", "html"}).format, special_format::export_html);
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--export-help=man"}).format, special_format::export_man);
+
+    // the last one wins
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--version", "-h"}).format, special_format::help);
+}
+
+TEST(special_arguments, version_check)
+{
+    sharg::detail::special_arguments result =
+        sharg::detail::scan_special_arguments({"-i", "5", "--version-check", "false", "pos"});
+
+    EXPECT_TRUE(result.error.success());
+    EXPECT_EQ(result.version_check, false);
+    EXPECT_EQ(result.remaining, (std::vector<std::string_view>{"-i", "5", "pos"}));
+    EXPECT_EQ(result.removed_indices, (std::vector<size_t>{3, 4})); // the program name is index 0
+
+    EXPECT_EQ(sharg::detail::scan_special_arguments({"--version-check", "1"}).version_check, true);
+}
+
+TEST(special_arguments, errors)
+{
+    sharg::parse_result error = sharg::detail::scan_special_arguments({"-i", "--export-help"}).error;
+    EXPECT_EQ(error.kind(), sharg::parse_error_kind::too_few_arguments);
+    EXPECT_EQ(error.argument_index(), 2u);
+    EXPECT_EQ(error.option_id(), "export-help");
+    EXPECT_EQ(error.message(), "Option --export-help must be followed by a value.");
+
+    error = sharg::detail::scan_special_arguments({"--export-help=pdf"}).error;
+    EXPECT_EQ(error.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_EQ(error.argument_index(), 1u);
+    EXPECT_EQ(error.message(), "Validation failed for option --export-help: Value must be one of [html, man]");
+
+    error = sharg::detail::scan_special_arguments({"-i", "--version-check"}).error;
+    EXPECT_EQ(error.kind(), sharg::parse_error_kind::too_few_arguments);
+    EXPECT_EQ(error.argument_index(), 2u);
+    EXPECT_EQ(error.option_id(), "version-check");
+    EXPECT_EQ(error.message(), "Option --version-check must be followed by a value.");
+
+    error = sharg::detail::scan_special_arguments({"--version-check", "maybe"}).error;
+    EXPECT_EQ(error.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_EQ(error.argument_index(), 2u);
+    EXPECT_EQ(error.message(), "Value for option --version-check must be true (1) or false (0).");
+}
@@ -7,7 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <sharg/detail/type_name_as_string.hpp>
 
@@ -57,5 +60,25 @@ TYPED_TEST_SUITE(type_inspection, reflection_types, );
 
 TYPED_TEST(type_inspection, type_name_as_string)
 {
-    EXPECT_EQ(sharg::detail::type_name_as_string<TypeParam>, this->expected_name());
+    EXPECT_EQ(sharg::detail::type_name_as_string<TypeParam>(), this->expected_name());
+}
+
+TYPED_TEST(type_inspection, concurrent_first_use)
+{
+    // The name is computed once, on the first call, even if several threads ask for it at the same time.
+    using type = std::tuple<TypeParam, foo::bar<>>;
+    std::vector<std::string const *> names(8);
+    std::vector<std::thread> threads{};
+
+    for (size_t i = 0; i < names.size(); ++i)
+        threads.emplace_back([&names, i] () { names[i] = &sharg::detail::type_name_as_string<type>(); });
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    for (std::string const * name : names)
+        EXPECT_EQ(name, names[0]);
+
+    EXPECT_EQ(names[0], &sharg::detail::type_name_as_string<type>());
+    EXPECT_FALSE(names[0]->empty());
 }
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+#include <sharg/detail/work_stealing_pool.hpp>
+
+TEST(work_stealing_pool, every_index_once)
+{
+    for (size_t const thread_count : {0u, 1u, 2u, 4u})
+    {
+        sharg::detail::work_stealing_pool pool{thread_count};
+        EXPECT_EQ(pool.size(), std::max<size_t>(thread_count, 1));
+
+        for (size_t const task_count : {0u, 1u, 3u, 1000u})
+        {
+            std::vector<std::atomic<int>> calls(task_count);
+            auto task = [&] (size_t const index) { ++calls[index]; };
+
+            pool.run(task_count, task);
+
+            for (std::atomic<int> const & count : calls)
+                EXPECT_EQ(count.load(), 1);
+        }
+    }
+}
+
+TEST(work_stealing_pool, uneven_tasks)
+{
+    sharg::detail::work_stealing_pool pool{4};
+    std::atomic<size_t> sum{0};
+
+    // the first quarter of the tasks is slow, so the other workers need to steal them
+    auto task = [&] (size_t const index)
+    {
+        if (index < 16)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        sum += index;
+    };
+
+    pool.run(64, task);
+    EXPECT_EQ(sum.load(), 64u * 63u / 2u);
+}
+
+TEST(work_stealing_pool, exception)
+{
+    sharg::detail::work_stealing_pool pool{2};
+    std::atomic<size_t> calls{0};
+
+    auto task = [&] (size_t const index)
+    {
+        ++calls;
+        if (index == 5)
+            throw std::runtime_error{"task failed"};
+    };
+
+    EXPECT_THROW(pool.run(10, task), std::runtime_error);
+    EXPECT_EQ(calls.load(), 10u);
+
+    // the pool is still usable
+    calls = 0;
+    auto other_task = [&] (size_t) { ++calls; };
+    EXPECT_NO_THROW(pool.run(10, other_task));
+    EXPECT_EQ(calls.load(), 10u);
+}
+
+TEST(work_stealing_pool, is_worker_thread)
+{
+    sharg::detail::work_stealing_pool pool{4};
+    std::atomic<size_t> outside_of_task{0};
+
+    EXPECT_FALSE(sharg::detail::work_stealing_pool::is_worker_thread());
+
+    auto task = [&] (size_t)
+    {
+        outside_of_task += !sharg::detail::work_stealing_pool::is_worker_thread();
+    };
+
+    pool.run(100, task);
+    EXPECT_EQ(outside_of_task.load(), 0u); // including the calling thread
+    EXPECT_FALSE(sharg::detail::work_stealing_pool::is_worker_thread());
+}
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <sharg/batch_validation.hpp>
+#include <sharg/validators.hpp>
+
+struct batch_validation_test : public ::testing::Test
+{
+    batch_validation_test()
+    {
+        schema.add_option(int_value, 'i', "int", "this is an int option.", sharg::option_spec::required,
+                          sharg::arithmetic_range_validator{0, 10});
+        schema.add_flag(flag_value, 'f', "flag", "this is a flag.");
+        schema.add_positional_option(name, "this is a positional option.");
+    }
+
+    int int_value{};
+    bool flag_value{false};
+    std::string name{};
+
+    sharg::parser_schema schema{"test_parser"};
+
+    struct line_result
+    {
+        size_t line_number;
+        std::string line;
+        sharg::parse_error_kind kind;
+    };
+
+    std::vector<line_result> validate(std::string const & manifest_content, size_t const thread_count)
+    {
+        std::istringstream manifest{manifest_content};
+        std::vector<line_result> results{};
+
+        summary = sharg::validate_batch(schema, manifest,
+                                        [&] (size_t line_number, std::string_view line, sharg::parse_result const & r)
+        {
+            results.push_back({line_number, std::string{line}, r.kind()});
+        }, thread_count);
+
+        return results;
+    }
+
+    sharg::batch_validation_summary summary{};
+};
+
+TEST_F(batch_validation_test, per_line_results)
+{
+    std::string const manifest{"app -i 5 'file name'\n"
+                               "\n"
+                               "# a comment\n"
+                               "app -i 11 file\n"
+                               "app -i 2 --unknown file\n"
+                               "app -i 1 -f \"file\n"
+                               "app -i=3 -f file"}; // no newline at the end
+
+    for (size_t const thread_count : {1u, 4u})
+    {
+        std::vector<line_result> const results = validate(manifest, thread_count);
+
+        ASSERT_EQ(results.size(), 5u);
+        EXPECT_EQ(summary.command_lines, 5u);
+        EXPECT_EQ(summary.invalid_command_lines, 3u);
+
+        EXPECT_EQ(results[0].line_number, 1u);
+        EXPECT_EQ(results[0].line, "app -i 5 'file name'");
+        EXPECT_EQ(results[0].kind, sharg::parse_error_kind::none);
+        EXPECT_EQ(results[1].line_number, 4u);
+        EXPECT_EQ(results[1].kind, sharg::parse_error_kind::validation_error);
+        EXPECT_EQ(results[2].line_number, 5u);
+        EXPECT_EQ(results[2].kind, sharg::parse_error_kind::unknown_option);
+        EXPECT_EQ(results[3].line_number, 6u);
+        EXPECT_EQ(results[3].kind, sharg::parse_error_kind::user_input_error);
+        EXPECT_EQ(results[4].line_number, 7u);
+        EXPECT_EQ(results[4].kind, sharg::parse_error_kind::none);
+    }
+}
+
+TEST_F(batch_validation_test, many_lines)
+{
+    std::string manifest{};
+    for (size_t i = 0; i < 10000; ++i)
+        manifest += "app -i " + std::to_string(i % 20) + " file_" + std::to_string(i) + "\n";
+
+    std::vector<line_result> const results = validate(manifest, 4);
+
+    ASSERT_EQ(results.size(), 10000u);
+    EXPECT_EQ(summary.invalid_command_lines, 10000u / 20u * 9u); // 11 to 19 are out of range
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i].line_number, i + 1);
+        EXPECT_EQ(results[i].kind == sharg::parse_error_kind::none, i % 20 <= 10);
+    }
+}
+
+TEST_F(batch_validation_test, empty_manifest)
+{
+    EXPECT_TRUE(validate("", 2).empty());
+    EXPECT_EQ(summary.command_lines, 0u);
+    EXPECT_EQ(summary.invalid_command_lines, 0u);
+}
@@ -47,6 +47,37 @@ struct parsing<Other::bar>
 };
 } // namespace sharg::custom
 
+namespace table
+{
+enum class bar
+{
+    one,
+    two,
+    three
+};
+
+constexpr auto enumeration_names(bar)
+{
+    return sharg::make_enumeration_name_table<bar>({{"one", bar::one}, {"two", bar::two}, {"three", bar::three}});
+}
+
+enum class baz
+{
+    one,
+    two
+};
+} // namespace table
+
+namespace sharg::custom
+{
+template <>
+struct parsing<table::baz>
+{
+    static constexpr auto enumeration_names = sharg::make_enumeration_name_table<table::baz>(
+        {{"one", table::baz::one}, {"1", table::baz::one}, {"two", table::baz::two}, {"2", table::baz::two}});
+};
+} // namespace sharg::custom
+
 TEST(parse_type_test, parse_success_enum_option)
 {
     {
@@ -202,3 +233,58 @@ TEST(parse_test, container_options)
 
     EXPECT_TRUE(option_values == (std::vector<foo::bar>{foo::bar::two, foo::bar::one, foo::bar::three}));
 }
+
+TEST(enumeration_name_table, lookup)
+{
+    constexpr auto names = table::enumeration_names(table::bar{});
+
+    static_assert(names.find("two")->second == table::bar::two);
+    static_assert(names.find("four") == names.end());
+    static_assert(names.begin()->first == "one"); // sorted by name
+
+    EXPECT_TRUE(sharg::named_enumeration<table::bar>);
+    EXPECT_TRUE(sharg::named_enumeration<table::baz>);
+    EXPECT_THROW((sharg::make_enumeration_name_table<table::bar>({{"one", table::bar::one},
+                                                                  {"one", table::bar::two}})),
+                 sharg::design_error);
+
+    std::ostringstream stream{};
+    stream << table::bar::three;
+    EXPECT_EQ(stream.str(), "three");
+}
+
+TEST(enumeration_name_table, parse)
+{
+    std::vector<table::bar> bars{};
+    table::baz baz{};
+
+    const char * argv[] = {"./parser_test", "-e", "two", "-e", "three", "-z", "2"};
+    sharg::parser parser{"test_parser", 7, argv, sharg::update_notifications::off};
+    parser.add_option(bars, 'e', "enum-option", "this is an enum option.", sharg::option_spec::standard,
+                      sharg::value_list_validator{(sharg::enumeration_names<table::bar> | std::views::values)});
+    parser.add_option(baz, 'z', "baz", "this is an enum option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(bars == (std::vector<table::bar>{table::bar::two, table::bar::three}));
+    EXPECT_TRUE(baz == table::baz::two);
+}
+
+TEST(enumeration_name_table, error_message)
+{
+    table::baz option_value{};
+
+    const char * argv[] = {"./parser_test", "-e", "nine"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(option_value, 'e', "enum-option", "this is an enum option.");
+
+    try
+    {
+        parser.parse();
+        FAIL();
+    }
+    catch (sharg::user_input_error const & exception)
+    {
+        EXPECT_STREQ(exception.what(), "You have chosen an invalid input value: nine. "
+                                       "Please use one of: [1, one, 2, two]");
+    }
+}
@@ -0,0 +1,394 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <sharg/file_handle.hpp>
+#include <sharg/parser_schema.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+namespace sharg::detail
+{
+struct test_accessor
+{
+    static void set_terminal_width(sharg::parser & parser, unsigned terminal_width)
+    {
+        std::visit([terminal_width] (auto & f)
+        {
+            if constexpr (std::is_same_v<decltype(f), sharg::detail::format_help &>)
+                f.layout = sharg::detail::format_help::console_layout_struct{terminal_width};
+        }, parser.format);
+    }
+};
+} // namespace sharg::detail
+
+TEST(input_file_handle, concepts)
+{
+    EXPECT_TRUE(sharg::parser_compatible_option<sharg::input_file_handle>);
+    EXPECT_TRUE(sharg::validator<sharg::input_file_open_validator>);
+}
+
+TEST(input_file_handle, parse_without_opening)
+{
+    sharg::input_file_handle handle{};
+    char const * argv[] = {"./parser_test", "-i", "my file.fa"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(handle, 'i', "input", "desc");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(handle.path(), "my file.fa"); // white space is part of the path
+    EXPECT_FALSE(handle.is_open());
+    EXPECT_EQ(handle.descriptor(), -1);
+    EXPECT_TRUE(handle.contents().empty());
+}
+
+TEST(input_file_handle, help_page)
+{
+    sharg::input_file_handle handle{};
+    char const * argv[] = {"./parser_test", "-h"};
+    sharg::parser parser{"test_parser", 2, argv, sharg::update_notifications::off};
+    sharg::detail::test_accessor::set_terminal_width(parser, 80);
+    parser.add_option(handle, 'i', "input", "desc", sharg::option_spec::standard,
+                      sharg::input_file_open_validator{{"fa"}});
+
+    testing::internal::CaptureStdout();
+    EXPECT_EXIT(parser.parse(), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+    std::string const help = testing::internal::GetCapturedStdout();
+    EXPECT_NE(help.find("    -i, --input (std::filesystem::path)\n"
+                        "          desc Default: \"\". The input file must exist and read permissions\n"
+                        "          must be granted. Valid file extensions are: [fa].\n"), std::string::npos) << help;
+}
+
+TEST(input_file_handle, open_descriptor)
+{
+    sharg::test::tmp_filename tmp{"reads.fa"};
+    std::ofstream{tmp.get_path()} << ">seq\nACGT\n";
+    std::string const path = tmp.get_path().string();
+
+    sharg::input_file_handle handle{};
+    char const * argv[] = {"./parser_test", "-i", path.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(handle, 'i', "input", "desc", sharg::option_spec::standard,
+                      sharg::input_file_open_validator{{"fa"}});
+
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_TRUE(handle.is_open());
+    EXPECT_TRUE(handle.contents().empty()); // not mapped
+
+    // the validated file is read even if the path is replaced
+    std::filesystem::remove(tmp.get_path());
+    std::ofstream{tmp.get_path()} << "replaced";
+
+    char buffer[16]{};
+    EXPECT_EQ(pread(handle.descriptor(), buffer, sizeof(buffer), 0), 10);
+    EXPECT_EQ(std::string_view{buffer}, ">seq\nACGT\n");
+
+    // copies share the open file
+    sharg::input_file_handle const copy{handle};
+    EXPECT_EQ(copy.descriptor(), handle.descriptor());
+}
+
+TEST(input_file_handle, memory_map)
+{
+    sharg::test::tmp_filename tmp{"reads.fa"};
+    std::ofstream{tmp.get_path()} << ">seq\nACGT\n";
+    std::string const path = tmp.get_path().string();
+
+    std::vector<sharg::input_file_handle> handles{};
+    char const * argv[] = {"./parser_test", path.c_str(), path.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_positional_option(handles, "desc",
+                                 sharg::input_file_open_validator{sharg::input_file_open_options::memory_map});
+
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_EQ(handles.size(), 2u);
+    EXPECT_TRUE(handles[0].is_open());
+    EXPECT_EQ(handles[0].contents(), ">seq\nACGT\n");
+    EXPECT_EQ(handles[1].contents(), ">seq\nACGT\n");
+    EXPECT_NE(handles[0].descriptor(), handles[1].descriptor());
+
+    // an empty file is opened but not mapped
+    sharg::test::tmp_filename empty{"empty.fa"};
+    std::ofstream{empty.get_path()};
+    sharg::input_file_handle empty_handle{empty.get_path()};
+    EXPECT_NO_THROW(sharg::input_file_open_validator{sharg::input_file_open_options::memory_map}(empty_handle));
+    EXPECT_TRUE(empty_handle.is_open());
+    EXPECT_TRUE(empty_handle.contents().empty());
+}
+
+TEST(input_file_handle, errors)
+{
+    sharg::test::tmp_filename tmp{"reads.fa"};
+    sharg::input_file_open_validator const validator{{"fa"}};
+
+    sharg::input_file_handle missing{tmp.get_path()};
+    EXPECT_THROW(validator(missing), sharg::validation_error);
+    EXPECT_FALSE(missing.is_open());
+
+    // wrong extension: the file is closed again
+    sharg::test::tmp_filename wrong_extension{"reads.sam"};
+    std::ofstream{wrong_extension.get_path()};
+    sharg::input_file_handle wrong{wrong_extension.get_path()};
+    EXPECT_THROW(validator(wrong), sharg::validation_error);
+    EXPECT_FALSE(wrong.is_open());
+
+    // not a regular file
+    sharg::test::tmp_filename directory{"dir.fa"};
+    std::filesystem::create_directory(directory.get_path());
+    EXPECT_THROW(validator(sharg::input_file_handle{directory.get_path()}), sharg::validation_error);
+
+    sharg::test::tmp_filename fifo{"fifo.fa"};
+    mkfifo(fifo.get_path().c_str(), 0644);
+    EXPECT_THROW(validator(sharg::input_file_handle{fifo.get_path()}), sharg::validation_error); // does not block
+
+    // the path based checks are still available
+    EXPECT_THROW(validator(tmp.get_path()), sharg::validation_error);
+}
+
+TEST(output_file_handle, concepts)
+{
+    EXPECT_TRUE(sharg::parser_compatible_option<sharg::output_file_handle>);
+    EXPECT_TRUE(sharg::validator<sharg::output_file_open_validator>);
+}
+
+TEST(output_file_handle, parse_without_creating)
+{
+    sharg::output_file_handle handle{};
+    char const * argv[] = {"./parser_test", "-o", "my file.sam"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(handle, 'o', "output", "desc");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(handle.path(), "my file.sam");
+    EXPECT_FALSE(handle.is_open());
+    EXPECT_EQ(handle.descriptor(), -1);
+    EXPECT_FALSE(std::filesystem::exists("my file.sam"));
+}
+
+TEST(output_file_handle, help_page)
+{
+    sharg::output_file_handle handle{};
+    char const * argv[] = {"./parser_test", "-h"};
+    sharg::parser parser{"test_parser", 2, argv, sharg::update_notifications::off};
+    sharg::detail::test_accessor::set_terminal_width(parser, 80);
+    parser.add_option(handle, 'o', "output", "desc", sharg::option_spec::standard,
+                      sharg::output_file_open_validator{{"sam"}});
+
+    testing::internal::CaptureStdout();
+    EXPECT_EXIT(parser.parse(), ::testing::ExitedWithCode(EXIT_SUCCESS), "");
+    std::string const help = testing::internal::GetCapturedStdout();
+    EXPECT_NE(help.find("    -o, --output (std::filesystem::path)\n"
+                        "          desc Default: \"\". The output file must not exist already and write\n"
+                        "          permissions must be granted. Valid file extensions are: [sam].\n"), std::string::npos) << help;
+}
+
+TEST(output_file_handle, create_new)
+{
+    sharg::test::tmp_filename tmp{"out.sam"};
+    std::string const path = tmp.get_path().string();
+
+    sharg::output_file_handle handle{};
+    char const * argv[] = {"./parser_test", "-o", path.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(handle, 'o', "output", "desc", sharg::option_spec::standard,
+                      sharg::output_file_open_validator{{"sam"}});
+
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_TRUE(handle.is_open());
+    EXPECT_TRUE(handle.created());
+    EXPECT_TRUE(std::filesystem::exists(tmp.get_path()));
+
+    EXPECT_EQ(write(handle.descriptor(), "@HD\n", 4), 4);
+
+    // the file exists now
+    sharg::output_file_handle again{tmp.get_path()};
+    EXPECT_THROW(sharg::output_file_open_validator{{"sam"}}(again), sharg::validation_error);
+    EXPECT_FALSE(again.is_open());
+
+    // a written file is kept
+    handle = sharg::output_file_handle{};
+    std::ifstream file{tmp.get_path()};
+    std::string contents{};
+    std::getline(file, contents);
+    EXPECT_EQ(contents, "@HD");
+}
+
+TEST(output_file_handle, empty_file_is_kept)
+{
+    sharg::test::tmp_filename tmp{"out.sam"};
+    sharg::output_file_open_validator const validator{sharg::output_file_open_options::create_new, {}, 4096};
+
+    // outside of a parse
+    {
+        sharg::output_file_handle handle{tmp.get_path()};
+        validator(handle);
+        ASSERT_TRUE(handle.is_open());
+        EXPECT_TRUE(handle.created());
+        EXPECT_EQ(std::filesystem::file_size(tmp.get_path()), 0u); // the reserved space does not change the size
+    }
+    EXPECT_TRUE(std::filesystem::exists(tmp.get_path()));
+
+    // after a successful parse
+    sharg::test::tmp_filename parsed{"parsed.sam"};
+    std::string const path = parsed.get_path().string();
+    {
+        sharg::output_file_handle handle{};
+        char const * argv[] = {"./parser_test", "-o", path.c_str()};
+        sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+        parser.add_option(handle, 'o', "output", "desc", sharg::option_spec::standard, validator);
+
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_TRUE(handle.created());
+    }
+    EXPECT_TRUE(std::filesystem::exists(parsed.get_path()));
+}
+
+TEST(output_file_handle, empty_file_is_removed_if_parsing_fails)
+{
+    sharg::test::tmp_filename empty{"empty.sam"};
+    sharg::test::tmp_filename written{"written.sam"};
+    std::string const empty_path = empty.get_path().string();
+    std::string const written_path = written.get_path().string();
+
+    int value{};
+    sharg::output_file_handle empty_handle{};
+    sharg::output_file_handle written_handle{};
+    struct header_writer
+    {
+        using option_value_type = sharg::output_file_handle;
+        void operator()(sharg::output_file_handle const & handle) const
+        {
+            if (write(handle.descriptor(), "@HD\n", 4) != 4)
+                throw sharg::validation_error{"Cannot write."};
+        }
+        std::string get_help_page_message() const { return ""; }
+    };
+
+    // the options are parsed first, the invalid positional option afterwards
+    char const * argv[] = {"./parser_test", "-o", empty_path.c_str(), "-w", written_path.c_str(), "abc"};
+    sharg::parser parser{"test_parser", 6, argv, sharg::update_notifications::off};
+    parser.add_option(empty_handle, 'o', "output", "desc", sharg::option_spec::standard,
+                      sharg::output_file_open_validator{});
+    parser.add_option(written_handle, 'w', "written", "desc", sharg::option_spec::standard,
+                      sharg::output_file_open_validator{} | header_writer{});
+    parser.add_positional_option(value, "desc");
+
+    EXPECT_THROW(parser.parse(), sharg::user_input_error);
+    EXPECT_FALSE(std::filesystem::exists(empty.get_path()));
+    EXPECT_TRUE(std::filesystem::exists(written.get_path())); // not empty
+}
+
+TEST(output_file_handle, parser_schema_does_not_create_files)
+{
+    sharg::test::tmp_filename tmp{"out.sam"};
+    std::string const path = tmp.get_path().string();
+
+    sharg::output_file_handle handle{};
+    sharg::parser_schema schema{"test_parser"};
+    schema.add_option(handle, 'o', "output", "desc", sharg::option_spec::standard, sharg::output_file_open_validator{});
+
+    // creating and removing the file would update the modification time of the directory
+    std::filesystem::path const directory = tmp.get_path().parent_path();
+    std::filesystem::file_time_type const past = std::filesystem::last_write_time(directory) - std::chrono::hours{1};
+    std::filesystem::last_write_time(directory, past);
+
+    EXPECT_TRUE(schema.validate({"./parser_test", "-o", path}));
+    EXPECT_FALSE(std::filesystem::exists(tmp.get_path()));
+    EXPECT_FALSE(handle.is_open());
+    EXPECT_EQ(std::filesystem::last_write_time(directory), past);
+
+    // the same path can be validated concurrently, no validation sees a file created by another one
+    std::vector<std::thread> threads{};
+    std::atomic<size_t> failures{0};
+
+    for (size_t i = 0; i < 4; ++i)
+        threads.emplace_back([&] ()
+        {
+            for (size_t j = 0; j < 100; ++j)
+                failures += !schema.validate({"./parser_test", "-o", path}).success();
+        });
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    EXPECT_EQ(failures.load(), 0u);
+    EXPECT_FALSE(std::filesystem::exists(tmp.get_path()));
+
+    // the path based checks still apply
+    std::ofstream{tmp.get_path()} << "old";
+    sharg::parse_result const result = schema.validate({"./parser_test", "-o", path});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_NE(result.message().find("already exists"), std::string::npos);
+    EXPECT_EQ(std::filesystem::file_size(tmp.get_path()), 3u);
+}
+
+TEST(output_file_handle, open_or_create)
+{
+    sharg::test::tmp_filename tmp{"out.sam"};
+    std::ofstream{tmp.get_path()} << "old";
+    sharg::output_file_open_validator const validator{sharg::output_file_open_options::open_or_create, {"sam"}};
+
+    {
+        sharg::output_file_handle handle{tmp.get_path()};
+        EXPECT_NO_THROW(validator(handle));
+        ASSERT_TRUE(handle.is_open());
+        EXPECT_FALSE(handle.created());
+        EXPECT_EQ(std::filesystem::file_size(tmp.get_path()), 3u); // not truncated
+    }
+    EXPECT_TRUE(std::filesystem::exists(tmp.get_path()));
+
+    std::vector<sharg::output_file_handle> handles{};
+    sharg::test::tmp_filename other{"other.sam"};
+    std::string const path = tmp.get_path().string();
+    std::string const other_path = other.get_path().string();
+    char const * argv[] = {"./parser_test", path.c_str(), other_path.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_positional_option(handles, "desc", validator);
+
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_EQ(handles.size(), 2u);
+    EXPECT_FALSE(handles[0].created());
+    EXPECT_TRUE(handles[1].created());
+    EXPECT_NE(handles[0].descriptor(), handles[1].descriptor());
+}
+
+TEST(output_file_handle, errors)
+{
+    sharg::test::tmp_filename tmp{"out.sam"};
+    sharg::output_file_open_validator const validator{sharg::output_file_open_options::open_or_create, {"sam"}};
+
+    // wrong extension: nothing is created
+    sharg::test::tmp_filename wrong_extension{"out.bam"};
+    sharg::output_file_handle wrong{wrong_extension.get_path()};
+    EXPECT_THROW(validator(wrong), sharg::validation_error);
+    EXPECT_FALSE(wrong.is_open());
+    EXPECT_FALSE(std::filesystem::exists(wrong_extension.get_path()));
+
+    // missing parent directory
+    EXPECT_THROW(validator(sharg::output_file_handle{tmp.get_path() / "out.sam"}), sharg::validation_error);
+
+    // not a regular file
+    sharg::test::tmp_filename directory{"dir.sam"};
+    std::filesystem::create_directory(directory.get_path());
+    EXPECT_THROW(validator(sharg::output_file_handle{directory.get_path()}), sharg::validation_error);
+
+    sharg::test::tmp_filename fifo{"fifo.sam"};
+    mkfifo(fifo.get_path().c_str(), 0644);
+    EXPECT_THROW(validator(sharg::output_file_handle{fifo.get_path()}), sharg::validation_error); // does not block
+
+    // the path based checks are still available
+    EXPECT_NO_THROW(validator(tmp.get_path()));
+    EXPECT_FALSE(std::filesystem::exists(tmp.get_path()));
+}
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <ranges>
 
 #include <sharg/parser.hpp>
@@ -1094,3 +1095,389 @@ TEST(parse_test, container_default)
         EXPECT_TRUE(option_values == (std::vector<int>{2, 1, 3}));
     }
 }
+
+TEST(parse_test, container_options_with_list_delimiter)
+{
+    std::vector<int> int_values{};
+    std::vector<std::string> string_values{};
+
+    auto try_parse = [&] (std::vector<char const *> argv)
+    {
+        sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(),
+                             sharg::update_notifications::off};
+        parser.add_option(int_values, 'i', "ids", "this is an int list option.", sharg::option_spec::standard,
+                          sharg::arithmetic_range_validator{0, 10});
+        parser.add_option(string_values, 's', "strings", "this is a string list option.");
+        parser.set_list_delimiter("ids", ',');
+        parser.set_list_delimiter('s', ':');
+        return parser.try_parse();
+    };
+
+    // all forms of key-value pairs
+    for (char const * arg : {"--ids=1,2,3", "-i1,2,3", "-i=1,2,3"})
+    {
+        EXPECT_TRUE(try_parse({"./parser_test", arg}));
+        EXPECT_EQ(int_values, (std::vector<int>{1, 2, 3}));
+    }
+
+    EXPECT_TRUE(try_parse({"./parser_test", "--ids", "1,2,3"}));
+    EXPECT_EQ(int_values, (std::vector<int>{1, 2, 3}));
+
+    // delimited values can be combined with repeated identifiers
+    EXPECT_TRUE(try_parse({"./parser_test", "-i", "4", "-i1,2", "-s", "a:b", "-i", "3,0", "-s", "c"}));
+    EXPECT_EQ(int_values, (std::vector<int>{4, 1, 2, 3, 0}));
+    EXPECT_EQ(string_values, (std::vector<std::string>{"a", "b", "c"}));
+
+    // a value without a delimiter
+    EXPECT_TRUE(try_parse({"./parser_test", "-i", "7"}));
+    EXPECT_EQ(int_values, (std::vector<int>{7}));
+
+    // the delimiter of one option does not split the values of another one
+    EXPECT_TRUE(try_parse({"./parser_test", "-s", "a,b::c"}));
+    EXPECT_EQ(string_values, (std::vector<std::string>{"a,b", "", "c"}));
+
+    sharg::parse_result result = try_parse({"./parser_test", "-s", "a", "--ids=1,2a,3"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_EQ(result.argument_index(), 3u);
+    EXPECT_EQ(result.message(), "Value parse failed for --ids: Argument 2a could not be parsed as type "
+                                "signed 32 bit integer.");
+
+    result = try_parse({"./parser_test", "--ids=1,,3"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+
+    result = try_parse({"./parser_test", "--ids=1,2,"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+
+    result = try_parse({"./parser_test", "--ids=1,20,3"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_EQ(result.message(), "Validation failed for option -i/--ids: Value 20 is not in range [0,10].");
+}
+
+TEST(parse_test, container_options_with_list_delimiter_many_values)
+{
+    std::string ids{"0"};
+    for (int i = 1; i < 50000; ++i)
+        ids += ',' + std::to_string(i);
+
+    std::vector<uint32_t> values{};
+    char const * argv[] = {"./parser_test", "--ids", ids.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(values, 'i', "ids", "this is a list option.");
+    parser.set_list_delimiter('i', ',');
+
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_EQ(values.size(), 50000u);
+
+    for (uint32_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(values[i], i);
+}
+
+TEST(parse_test, many_options_and_arguments)
+{
+    size_t constexpr option_count{150};
+    std::vector<int> option_values(option_count, -1);
+    std::vector<std::string> long_ids{};
+    for (size_t i = 0; i < option_count; ++i)
+        long_ids.push_back("option-" + std::to_string(i));
+
+    // every second option is given, once in `--id value` notation and once in `--id=value` notation
+    std::vector<std::string> arguments{"./parser_test"};
+    for (size_t i = 0; i < option_count; i += 2)
+    {
+        if (i % 4 == 0)
+        {
+            arguments.push_back("--" + long_ids[i]);
+            arguments.push_back(std::to_string(i));
+        }
+        else
+        {
+            arguments.push_back("--" + long_ids[i] + "=" + std::to_string(i));
+        }
+    }
+    std::vector<char const *> argv{};
+    for (std::string const & argument : arguments)
+        argv.push_back(argument.c_str());
+
+    sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+    for (size_t i = 0; i < option_count; ++i)
+        parser.add_option(option_values[i], '\0', long_ids[i], "this is an int option.");
+
+    EXPECT_NO_THROW(parser.parse());
+
+    for (size_t i = 0; i < option_count; ++i)
+        EXPECT_EQ(option_values[i], (i % 2 == 0) ? static_cast<int>(i) : -1);
+}
+
+TEST(parse_test, option_value_looks_like_identifier)
+{
+    // the value of -i is "-f" and must not be recognised as the flag -f afterwards
+    std::string option_value{};
+    bool flag_value{false};
+    std::vector<std::string> positional_values{};
+
+    const char * argv[] = {"./parser_test", "-i", "-f", "--", "-x", "foo"};
+    sharg::parser parser{"test_parser", 6, argv, sharg::update_notifications::off};
+    parser.add_option(option_value, 'i', "input", "this is a string option.");
+    parser.add_flag(flag_value, 'f', "flag", "this is a flag.");
+    parser.add_positional_option(positional_values, "this is a list.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, "-f");
+    EXPECT_FALSE(flag_value);
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"-x", "foo"}));
+}
+
+TEST(parse_test, arguments_are_not_modified)
+{
+    // flag clusters are split up while parsing, but the original command line must stay untouched
+    bool flag_a{false};
+    bool flag_b{false};
+    std::string option_value{};
+
+    char arg0[]{"./parser_test"};
+    char arg1[]{"build"};
+    char arg2[]{"-ab"};
+    char arg3[]{"--input=foo"};
+    char * argv[]{arg0, arg1, arg2, arg3};
+
+    sharg::parser top_level_parser{"test_parser", 4, argv, sharg::update_notifications::off, {"build"}};
+    EXPECT_NO_THROW(top_level_parser.parse());
+
+    sharg::parser & sub_parser = top_level_parser.get_sub_parser();
+    sub_parser.add_flag(flag_a, 'a', "flag-a", "this is a flag.");
+    sub_parser.add_flag(flag_b, 'b', "flag-b", "this is a flag.");
+    sub_parser.add_option(option_value, 'i', "input", "this is a string option.");
+
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_TRUE(flag_a);
+    EXPECT_TRUE(flag_b);
+    EXPECT_EQ(option_value, "foo");
+    EXPECT_EQ(std::string_view{argv[2]}, "-ab");
+    EXPECT_EQ(std::string_view{argv[3]}, "--input=foo");
+}
+
+TEST(parse_test, try_parse)
+{
+    int int_value{};
+    std::vector<int> list_value{};
+    std::string positional_value{};
+
+    auto try_parse = [&] (std::vector<char const *> argv, bool with_positional = true)
+    {
+        sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(),
+                             sharg::update_notifications::off};
+        parser.add_option(int_value, 'i', "int", "this is an int option.", sharg::option_spec::standard,
+                          sharg::arithmetic_range_validator{0, 10});
+        parser.add_option(list_value, 'l', "list", "this is a list option.");
+        if (with_positional)
+            parser.add_positional_option(positional_value, "this is a positional option.");
+        return parser.try_parse();
+    };
+
+    sharg::parse_result result = try_parse({"./parser_test", "-i", "3", "foo"});
+    EXPECT_TRUE(result);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::none);
+    EXPECT_EQ(result.argument_index(), sharg::parse_result::npos);
+    EXPECT_EQ(int_value, 3);
+    EXPECT_EQ(positional_value, "foo");
+
+    result = try_parse({"./parser_test", "foo", "--int", "abc"});
+    EXPECT_FALSE(result);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_EQ(result.argument_index(), 3u);
+    EXPECT_EQ(result.option_id(), "--int");
+    EXPECT_EQ(result.message(), "Value parse failed for --int: Argument abc could not be parsed as type "
+                                "signed 32 bit integer.");
+
+    result = try_parse({"./parser_test", "--version-check", "0", "-i", "20", "foo"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_EQ(result.argument_index(), 4u); // --version-check 0 is still counted
+    EXPECT_EQ(result.option_id(), "-i/--int");
+
+    result = try_parse({"./parser_test", "-i", "1", "--int", "2", "foo"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::option_declared_multiple_times);
+
+    result = try_parse({"./parser_test", "-l", "1", "--unknown", "foo"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::unknown_option);
+    EXPECT_EQ(result.argument_index(), 3u);
+    EXPECT_TRUE(result.option_id().empty());
+
+    result = try_parse({"./parser_test", "foo", "bar"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::too_many_arguments);
+    EXPECT_EQ(result.argument_index(), 2u);
+
+    result = try_parse({"./parser_test", "-i"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::too_few_arguments);
+    EXPECT_EQ(result.argument_index(), 1u);
+    EXPECT_EQ(result.message(), "Missing value for option -i");
+
+    result = try_parse({"./parser_test", "-i", "1"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::too_few_arguments);
+    EXPECT_EQ(result.argument_index(), sharg::parse_result::npos);
+}
+
+TEST(parse_test, try_parse_and_parse_report_the_same_error)
+{
+    int int_value{};
+    const char * argv[] = {"./parser_test", "-i", "5", "-i", "6"};
+
+    sharg::parser parser1{"test_parser", 5, argv, sharg::update_notifications::off};
+    parser1.add_option(int_value, 'i', "int", "this is an int option.");
+    sharg::parse_result result = parser1.try_parse();
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::option_declared_multiple_times);
+
+    sharg::parser parser2{"test_parser", 5, argv, sharg::update_notifications::off};
+    parser2.add_option(int_value, 'i', "int", "this is an int option.");
+
+    try
+    {
+        parser2.parse();
+        FAIL();
+    }
+    catch (sharg::option_declared_multiple_times const & ex)
+    {
+        EXPECT_EQ(result.message(), ex.what());
+    }
+}
+
+TEST(parse_test, positional_option_sink)
+{
+    int int_value{};
+    std::vector<std::string> received{};
+
+    // callback
+    char const * argv[] = {"./parser_test", "first", "-i", "5", "second", "--", "-third"};
+    sharg::parser parser{"test_parser", 7, argv, sharg::update_notifications::off};
+    parser.add_option(int_value, 'i', "int", "this is an int option.");
+    parser.add_positional_option<std::string>([&received] (std::string && value)
+                                              {
+                                                  received.push_back(std::move(value));
+                                              }, "this is a positional sink.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(int_value, 5);
+    EXPECT_EQ(received, (std::vector<std::string>{"first", "second", "-third"}));
+
+    // output iterator
+    std::vector<int> numbers{};
+    std::string name{};
+    char const * argv2[] = {"./parser_test", "name", "1", "2", "3"};
+    sharg::parser parser2{"test_parser", 5, argv2, sharg::update_notifications::off};
+    parser2.add_positional_option(name, "this is a positional option.");
+    parser2.add_positional_option<int>(std::back_inserter(numbers), "this is a positional sink.");
+
+    EXPECT_NO_THROW(parser2.parse());
+    EXPECT_EQ(name, "name");
+    EXPECT_EQ(numbers, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(parse_test, positional_option_sink_errors)
+{
+    std::vector<int> numbers{};
+    auto sink = [&numbers] (int value) { numbers.push_back(value); };
+
+    // each value is validated before it is handed over
+    char const * argv[] = {"./parser_test", "1", "2", "30", "4"};
+    sharg::parser parser{"test_parser", 5, argv, sharg::update_notifications::off};
+    parser.add_positional_option<int>(sink, "this is a positional sink.", sharg::arithmetic_range_validator{0, 10});
+
+    sharg::parse_result const result = parser.try_parse();
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_EQ(result.argument_index(), 3u);
+    EXPECT_EQ(result.message(), "Validation failed for positional option 3: Value 30 is not in range [0,10].");
+    EXPECT_EQ(numbers, (std::vector<int>{1, 2}));
+
+    // parse error
+    numbers.clear();
+    char const * argv2[] = {"./parser_test", "1", "abc"};
+    sharg::parser parser2{"test_parser", 3, argv2, sharg::update_notifications::off};
+    parser2.add_positional_option<int>(sink, "this is a positional sink.");
+    EXPECT_THROW(parser2.parse(), sharg::user_input_error);
+    EXPECT_EQ(numbers, (std::vector<int>{1}));
+
+}
+
+TEST(parse_test, positional_option_sink_without_values)
+{
+    int int_value{};
+    size_t sink_calls{0};
+
+    // all arguments are consumed by options
+    char const * argv[] = {"./parser_test", "-i", "5"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(int_value, 'i', "int", "this is an int option.");
+    parser.add_positional_option<int>([&sink_calls] (int) { ++sink_calls; }, "this is a positional sink.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(int_value, 5);
+    EXPECT_EQ(sink_calls, 0u);
+
+    // only the end of options
+    char const * argv2[] = {"./parser_test", "--"};
+    sharg::parser parser2{"test_parser", 2, argv2, sharg::update_notifications::off};
+    parser2.add_positional_option<int>([&sink_calls] (int) { ++sink_calls; }, "this is a positional sink.");
+
+    EXPECT_NO_THROW(parser2.parse());
+    EXPECT_EQ(sink_calls, 0u);
+}
+
+TEST(parse_test, positional_option_sink_design_errors)
+{
+    auto sink = [] (int) {};
+    std::vector<int> list{};
+    int value{};
+
+    // a sink consumes all remaining arguments, so nothing can follow it
+    char const * argv[] = {"./parser_test", "1"};
+    sharg::parser parser{"test_parser", 2, argv, sharg::update_notifications::off};
+    parser.add_positional_option<int>(sink, "this is a positional sink.");
+    EXPECT_THROW(parser.add_positional_option<int>(sink, "another sink."), sharg::design_error);
+    EXPECT_THROW(parser.add_positional_option(list, "a positional list."), sharg::design_error);
+    EXPECT_THROW(parser.add_positional_option(value, "a positional option."), sharg::design_error);
+
+    // a sink after a positional list
+    sharg::parser parser2{"test_parser", 2, argv, sharg::update_notifications::off};
+    parser2.add_positional_option(list, "a positional list.");
+    EXPECT_THROW(parser2.add_positional_option<int>(sink, "this is a positional sink."), sharg::design_error);
+}
+
+TEST(parse_test, positional_options_between_consumed_arguments)
+{
+    std::array<int, 100> values{};
+    std::vector<int> rest{};
+    std::vector<int> options{};
+    bool flag{false};
+
+    // every positional argument is preceded by an option that is consumed before the positional options are bound
+    std::vector<std::string> arguments{"./parser_test", "-f"};
+    for (int i = 0; i < 150; ++i)
+    {
+        arguments.push_back("-o");
+        arguments.push_back(std::to_string(-i));
+        arguments.push_back(std::to_string(i));
+        arguments.push_back(""); // empty arguments are ignored
+    }
+
+    std::vector<char const *> argv{};
+    for (std::string const & argument : arguments)
+        argv.push_back(argument.c_str());
+
+    sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+    parser.add_flag(flag, 'f', "flag", "this is a flag.");
+    parser.add_option(options, 'o', "option", "this is a list option.");
+    for (int & value : values)
+        parser.add_positional_option(value, "this is a positional option.");
+    parser.add_positional_option(rest, "this is a positional list option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(flag);
+    ASSERT_EQ(options.size(), 150u);
+    EXPECT_EQ(options.back(), -149);
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(values[i], i);
+
+    ASSERT_EQ(rest.size(), 50u);
+    EXPECT_EQ(rest.front(), 100);
+    EXPECT_EQ(rest.back(), 149);
+}
@@ -489,6 +489,91 @@ TEST(validator_test, output_directory)
     }
 }
 
+TEST(validator_test, input_file_list_reports_all_errors)
+{
+    sharg::test::tmp_filename tmp_dir_name{"input_files"};
+    std::filesystem::path const dir{tmp_dir_name.get_path()};
+    std::filesystem::create_directory(dir);
+
+    // enough files to be checked in parallel
+    size_t const file_count{sharg::input_file_validator::parallel_threshold * 3};
+    std::vector<std::filesystem::path> files{};
+
+    for (size_t i = 0; i < file_count; ++i)
+    {
+        files.push_back(dir / ("file" + std::to_string(i) + ".fa"));
+        std::ofstream{files.back()};
+    }
+
+    sharg::input_file_validator validator{std::vector{std::string{"fa"}}};
+    EXPECT_NO_THROW(validator(files));
+    EXPECT_NO_THROW(sharg::input_directory_validator{}(std::vector{dir, dir}));
+
+    // a single invalid path keeps its message
+    std::vector<std::filesystem::path> with_one_error{files};
+    with_one_error[5] = dir / "missing.fa";
+
+    try
+    {
+        validator(with_one_error);
+        FAIL();
+    }
+    catch (sharg::validation_error const & ex)
+    {
+        EXPECT_EQ(std::string{ex.what()}, "The file \"" + with_one_error[5].string() + "\" does not exist!");
+    }
+
+    // all invalid paths are reported in order
+    std::vector<std::filesystem::path> with_errors{files};
+    with_errors[3] = dir / "missing.fa";
+    with_errors[70] = dir / "missing.sam";
+    with_errors.back() = dir;
+
+    try
+    {
+        validator(with_errors);
+        FAIL();
+    }
+    catch (sharg::validation_error const & ex)
+    {
+        EXPECT_EQ(std::string{ex.what()},
+                  "3 of " + std::to_string(file_count) + " paths are invalid:\n"
+                  "The file \"" + with_errors[3].string() + "\" does not exist!\n"
+                  "The file \"" + with_errors[70].string() + "\" does not exist!\n"
+                  "The given filename " + dir.string() + " has no extension. Expected one of the following valid "
+                  "extensions:[fa]!");
+    }
+
+    std::vector<std::filesystem::path> directories{dir, dir / "missing", files[0]};
+    try
+    {
+        sharg::input_directory_validator{}(directories);
+        FAIL();
+    }
+    catch (sharg::validation_error const & ex)
+    {
+        EXPECT_EQ(std::string{ex.what()},
+                  "2 of 3 paths are invalid:\n"
+                  "The directory \"" + directories[1].string() + "\" does not exists!\n"
+                  "The path \"" + files[0].string() + "\" is not a directory!");
+    }
+
+    // through the parser
+    std::vector<std::filesystem::path> input_files;
+    std::string const path_0 = with_errors[0].string();
+    std::string const path_3 = with_errors[3].string();
+    std::string const path_4 = (dir / "missing_too.fa").string();
+    const char * argv[] = {"./parser_test", path_0.c_str(), path_3.c_str(), path_4.c_str()};
+    sharg::parser parser{"test_parser", 4, argv, sharg::update_notifications::off};
+    parser.add_positional_option(input_files, "desc", validator);
+
+    sharg::parse_result const result = parser.try_parse();
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_NE(result.message().find("2 of 3 paths are invalid:"), std::string::npos);
+
+    std::filesystem::remove_all(dir);
+}
+
 TEST(validator_test, inputfile_not_readable)
 {
     sharg::test::tmp_filename tmp_name{"my_file.test"};
@@ -660,6 +745,44 @@ TEST(validator_test, outputdir_not_writable)
     }
 }
 
+TEST(validator_test, output_validators_do_not_write)
+{
+    sharg::test::tmp_filename tmp_name{"out"};
+    std::filesystem::path const dir{tmp_name.get_path()};
+
+    // a missing output directory is not created
+    EXPECT_NO_THROW(sharg::output_directory_validator{}(dir));
+    EXPECT_FALSE(std::filesystem::exists(dir));
+    EXPECT_NO_THROW(sharg::output_directory_validator{}(dir.string() + "/"));
+    EXPECT_FALSE(std::filesystem::exists(dir));
+
+    // no file is created in an existing output directory
+    std::filesystem::create_directory(dir);
+    EXPECT_NO_THROW(sharg::output_directory_validator{}(dir));
+    EXPECT_TRUE(std::filesystem::is_empty(dir));
+
+    // a missing output file is not created
+    std::filesystem::path const file{dir / "result.txt"};
+    EXPECT_NO_THROW(sharg::output_file_validator{sharg::output_file_open_options::create_new}(file));
+    EXPECT_FALSE(std::filesystem::exists(file));
+
+    // an existing output file is not truncated
+    std::ofstream{file} << "content";
+    EXPECT_NO_THROW(sharg::output_file_validator{sharg::output_file_open_options::open_or_create}(file));
+    EXPECT_EQ(std::filesystem::file_size(file), 7u);
+
+    // the output file is a directory or an output directory is a file
+    EXPECT_THROW(sharg::output_file_validator{sharg::output_file_open_options::open_or_create}(dir),
+                 sharg::validation_error);
+    EXPECT_THROW(sharg::output_directory_validator{}(file), sharg::validation_error);
+
+    // the parent is a file
+    EXPECT_THROW(sharg::output_file_validator{}(file / "result.txt"), sharg::validation_error);
+    EXPECT_THROW(sharg::output_directory_validator{}(file / "dir"), sharg::validation_error);
+
+    std::filesystem::remove_all(dir);
+}
+
 TEST(validator_test, arithmetic_range_validator_success)
 {
     int option_value{0};
@@ -841,6 +964,109 @@ TEST(validator_test, arithmetic_range_validator_error)
     EXPECT_THROW(parser7.parse(), sharg::validation_error);
 }
 
+TEST(validator_test, arithmetic_range_validator_large_lists)
+{
+    // the range of list values is checked while parsing; the errors must be the same as when validating afterwards
+    std::vector<std::string> arguments{"./parser_test", "--"};
+    for (int i = 0; i < 1000; ++i)
+        arguments.push_back(std::to_string(i - 500));
+
+    auto parse = [] (std::vector<std::string> const & args, auto validator) -> std::string
+    {
+        std::vector<char const *> argv{};
+        for (std::string const & arg : args)
+            argv.push_back(arg.c_str());
+
+        std::vector<int64_t> values{};
+        sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(),
+                             sharg::update_notifications::off};
+        parser.add_positional_option(values, "desc", validator);
+
+        try
+        {
+            parser.parse();
+        }
+        catch (sharg::parser_error const & error)
+        {
+            return error.what();
+        }
+
+        EXPECT_EQ(values.size(), args.size() - 2);
+        EXPECT_EQ(values.front(), -500);
+        EXPECT_EQ(values.back(), 499);
+        return "";
+    };
+
+    EXPECT_EQ(parse(arguments, sharg::arithmetic_range_validator{-500, 499}), "");
+    EXPECT_EQ(parse(arguments, sharg::arithmetic_range_validator{-499, 499}),
+              "Validation failed for positional option 1001: Value -500 is not in range [-499,499].");
+    EXPECT_EQ(parse(arguments, sharg::arithmetic_range_validator{-500, 400}),
+              "Validation failed for positional option 1001: Value 401 is not in range [-500,400].");
+
+    // a parse error is reported even if an earlier value is out of range
+    arguments.push_back("12a");
+    EXPECT_EQ(parse(arguments, sharg::arithmetic_range_validator{-499, 499}),
+              "Value parse failed for positional option1001: Argument 12a could not be parsed as type signed 64 bit "
+              "integer.");
+
+    // options
+    std::vector<double> weights{};
+    char const * argv[] = {"./parser_test", "-w", "0.5", "-w", "1e-3", "--weight", "1.5"};
+    sharg::parser parser{"test_parser", 7, argv, sharg::update_notifications::off};
+    parser.add_option(weights, 'w', "weight", "desc", sharg::option_spec::standard,
+                      sharg::arithmetic_range_validator{0.0, 1.0});
+
+    try
+    {
+        parser.parse();
+        FAIL();
+    }
+    catch (sharg::validation_error const & error)
+    {
+        EXPECT_STREQ(error.what(), "Validation failed for option -w/--weight: Value 1.500000 is not in range "
+                                   "[0.000000,1.000000].");
+    }
+}
+
+TEST(validator_test, arithmetic_range_validator_required_option)
+{
+    auto parse = [] (std::vector<char const *> const & argv, auto & value)
+    {
+        sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(),
+                             sharg::update_notifications::off};
+        parser.add_option(value, 'i', "int", "desc", sharg::option_spec::required,
+                          sharg::arithmetic_range_validator{1, 20});
+        return parser.try_parse();
+    };
+
+    // list: the values are checked while they are parsed
+    std::vector<int> list{};
+    sharg::parse_result result = parse({"./parser_test", "-i", "1", "-i", "2"}, list);
+    EXPECT_TRUE(result) << result.message();
+    EXPECT_EQ(list, (std::vector<int>{1, 2}));
+
+    list.clear();
+    result = parse({"./parser_test", "-i", "1", "--int", "30"}, list);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+
+    list.clear();
+    result = parse({"./parser_test", "--version-check", "0"}, list);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::required_option_missing);
+    EXPECT_EQ(result.message(), "Option -i/--int is required but not set.");
+
+    // scalar
+    int scalar{};
+    result = parse({"./parser_test", "-i", "5"}, scalar);
+    EXPECT_TRUE(result) << result.message();
+    EXPECT_EQ(scalar, 5);
+
+    result = parse({"./parser_test", "-i", "30"}, scalar);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+
+    result = parse({"./parser_test", "--version-check", "0"}, scalar);
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::required_option_missing);
+}
+
 enum class foo
 {
     one,
@@ -1022,6 +1248,82 @@ TEST(validator_test, value_list_validator_error)
     EXPECT_THROW(parser5.parse(), sharg::validation_error);
 }
 
+// totally ordered, but without std::hash specialisation
+struct ordered_id
+{
+    int value{};
+
+    friend bool operator==(ordered_id const &, ordered_id const &) = default;
+    friend auto operator<=>(ordered_id const &, ordered_id const &) = default;
+
+    friend std::ostream & operator<<(std::ostream & stream, ordered_id const & id)
+    {
+        return stream << "id" << id.value;
+    }
+
+    friend std::istream & operator>>(std::istream & stream, ordered_id & id)
+    {
+        return stream >> id.value;
+    }
+};
+
+TEST(validator_test, value_list_validator_large_lists)
+{
+    size_t const size{10000};
+    std::vector<std::string> names(size);
+    std::vector<int> numbers(size);
+    std::vector<ordered_id> ids(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        names[i] = "chr" + std::to_string(i);
+        numbers[i] = static_cast<int>(size - i) * 3; // not sorted
+        ids[i] = ordered_id{static_cast<int>(size - i) * 3};
+    }
+    names.push_back("chr1"); // duplicates are fine
+
+    sharg::value_list_validator name_validator{names};
+    sharg::value_list_validator number_validator{numbers};
+    sharg::value_list_validator id_validator{ids};
+
+    for (size_t i = 0; i < size; i += 97)
+    {
+        EXPECT_NO_THROW(name_validator(names[i]));
+        EXPECT_NO_THROW(number_validator(numbers[i]));
+        EXPECT_NO_THROW(id_validator(ids[i]));
+        EXPECT_THROW(number_validator(numbers[i] + 1), sharg::validation_error);
+        EXPECT_THROW(id_validator(ordered_id{numbers[i] - 1}), sharg::validation_error);
+    }
+
+    EXPECT_NO_THROW(name_validator(names));
+    EXPECT_NO_THROW(number_validator(numbers));
+    EXPECT_NO_THROW(id_validator(ids));
+    EXPECT_THROW(name_validator(std::string{"chrX"}), sharg::validation_error);
+    EXPECT_THROW(name_validator(std::string{""}), sharg::validation_error);
+    EXPECT_THROW(id_validator(ordered_id{0}), sharg::validation_error);
+    EXPECT_THROW(id_validator(ordered_id{size * 3 + 1}), sharg::validation_error);
+
+    // copies share the index
+    sharg::value_list_validator const copy{name_validator};
+    EXPECT_NO_THROW(copy(std::string{"chr9999"}));
+    EXPECT_THROW(copy(std::string{"chr10000"}), sharg::validation_error);
+
+    // the help page message and the error message are bounded
+    std::string const listed{"[chr0, chr1, chr2, chr3, chr4, chr5, chr6, chr7, chr8, chr9, chr10, chr11, chr12, "
+                             "chr13, chr14, chr15, chr16, chr17, chr18, chr19, ...] (10001 values in total)"};
+    EXPECT_EQ(name_validator.get_help_page_message(), "Value must be one of " + listed + ".");
+
+    try
+    {
+        name_validator(std::string{"chrX"});
+        FAIL();
+    }
+    catch (sharg::validation_error const & error)
+    {
+        EXPECT_EQ(std::string{error.what()}, "Value chrX is not one of " + listed + ".");
+    }
+}
+
 TEST(validator_test, regex_validator_success)
 {
     std::string option_value;
@@ -1167,6 +1469,43 @@ TEST(validator_test, regex_validator_error)
     EXPECT_THROW(parser4.parse(), sharg::validation_error);
 }
 
+TEST(validator_test, regex_validator_dfa_engine)
+{
+    sharg::regex_validator id_validator{"[A-Z]{2}[0-9]{6}(\\.[0-9]+)?", sharg::regex_engine::dfa};
+
+    EXPECT_NO_THROW(id_validator(std::string{"AB123456"}));
+    EXPECT_NO_THROW(id_validator(std::string{"AB123456.12"}));
+    EXPECT_THROW(id_validator(std::string{"AB12345"}), sharg::validation_error);
+    EXPECT_EQ(id_validator.get_help_page_message(), "Value must match the pattern '[A-Z]{2}[0-9]{6}(\\.[0-9]+)?'.");
+
+    // list of values
+    std::vector<std::string> ids(1000, "XY000001.1");
+    EXPECT_NO_THROW(id_validator(ids));
+    ids.back() = "XY0000011";
+    EXPECT_THROW(id_validator(ids), sharg::validation_error);
+
+    // copies share the automaton
+    sharg::regex_validator const copy{id_validator};
+    EXPECT_NO_THROW(copy(std::string{"AB123456"}));
+
+    // through the parser
+    std::vector<std::string> option_vector;
+    const char * argv[] = {"./parser_test", "-s", "AB123456", "-s", "CD654321.2"};
+    sharg::parser parser{"test_parser", 5, argv, sharg::update_notifications::off};
+    parser.add_option(option_vector, 's', "", "desc", sharg::option_spec::standard, id_validator);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_vector, (std::vector<std::string>{"AB123456", "CD654321.2"}));
+
+    // unsupported syntax
+    EXPECT_THROW((sharg::regex_validator{"(a)\\1", sharg::regex_engine::dfa}), sharg::design_error);
+}
+
+TEST(validator_test, regex_validator_invalid_pattern)
+{
+    EXPECT_THROW(sharg::regex_validator{"[a-"}, sharg::design_error);
+    EXPECT_THROW((sharg::regex_validator{"[a-", sharg::regex_engine::dfa}), sharg::design_error);
+}
+
 TEST(validator_test, chaining_validators_common_type)
 {
     // chaining integral options stay integral
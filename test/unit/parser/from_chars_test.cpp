@@ -0,0 +1,163 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+
+namespace foo
+{
+// parsed via ADL
+struct point
+{
+    int x{};
+    int y{};
+
+    friend std::from_chars_result from_chars(std::string_view const in, point & p)
+    {
+        char const * const end = in.data() + in.size();
+        std::from_chars_result res = std::from_chars(in.data(), end, p.x);
+
+        if (res.ec != std::errc{} || res.ptr == end || *res.ptr != ',')
+            return {res.ptr, std::errc::invalid_argument};
+
+        return std::from_chars(res.ptr + 1, end, p.y);
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, point const & p)
+    {
+        return stream << p.x << ',' << p.y;
+    }
+
+    bool operator==(point const &) const = default;
+};
+
+// parsed via the stream operator, but sharg::from_chars is preferred
+struct streamed
+{
+    std::string value{};
+    bool used_from_chars{false};
+
+    friend std::istream & operator>>(std::istream & stream, streamed & s)
+    {
+        return stream >> s.value;
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, streamed const & s)
+    {
+        return stream << s.value;
+    }
+};
+} // namespace foo
+
+namespace Other
+{
+struct id
+{
+    unsigned value{};
+};
+
+inline std::ostream & operator<<(std::ostream & stream, id const & i)
+{
+    return stream << i.value;
+}
+} // namespace Other
+
+namespace sharg::custom
+{
+template <>
+struct parsing<Other::id>
+{
+    static std::from_chars_result from_chars(std::string_view const in, Other::id & i)
+    {
+        if (!in.starts_with("ID"))
+            return {in.data(), std::errc::invalid_argument};
+
+        return std::from_chars(in.data() + 2, in.data() + in.size(), i.value);
+    }
+};
+
+template <>
+struct parsing<foo::streamed>
+{
+    static std::from_chars_result from_chars(std::string_view const in, foo::streamed & s)
+    {
+        s.value = in;
+        s.used_from_chars = true;
+        return {in.data() + in.size(), std::errc{}};
+    }
+};
+} // namespace sharg::custom
+
+TEST(from_chars, concepts)
+{
+    EXPECT_TRUE(sharg::from_chars_parsable<foo::point>);
+    EXPECT_TRUE(sharg::from_chars_parsable<Other::id>);
+    EXPECT_FALSE(sharg::istreamable<foo::point>);
+    EXPECT_TRUE(sharg::parser_compatible_option<foo::point>);
+    EXPECT_TRUE(sharg::parser_compatible_option<Other::id>);
+    EXPECT_TRUE(sharg::from_chars_parsable<sharg::input_file_handle>);
+
+    EXPECT_FALSE(sharg::from_chars_parsable<int>);
+    EXPECT_FALSE(sharg::from_chars_parsable<std::string>);
+}
+
+TEST(from_chars, parse)
+{
+    foo::point point{};
+    std::vector<Other::id> ids{};
+    foo::streamed streamed{};
+
+    const char * argv[] = {"./parser_test", "-p", "3,4", "-i", "ID1", "-i", "ID22", "-s", "two words"};
+    sharg::parser parser{"test_parser", 9, argv, sharg::update_notifications::off};
+    parser.add_option(point, 'p', "point", "A point.");
+    parser.add_option(ids, 'i', "id", "The ids.");
+    parser.add_option(streamed, 's', "streamed", "Not streamed.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(point, (foo::point{3, 4}));
+    ASSERT_EQ(ids.size(), 2u);
+    EXPECT_EQ(ids[0].value, 1u);
+    EXPECT_EQ(ids[1].value, 22u);
+    EXPECT_TRUE(streamed.used_from_chars);
+    EXPECT_EQ(streamed.value, "two words");
+}
+
+TEST(from_chars, parse_error)
+{
+    for (char const * value : {"3", "3,", "3,4,", "3;4", "a,4"})
+    {
+        foo::point point{};
+        const char * argv[] = {"./parser_test", "-p", value};
+        sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+        parser.add_option(point, 'p', "point", "A point.");
+
+        EXPECT_THROW(parser.parse(), sharg::user_input_error) << value;
+    }
+
+    Other::id id{};
+    const char * argv[] = {"./parser_test", "-i", "ID99999999999"}; // out of range
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(id, 'i', "id", "The id.");
+
+    EXPECT_THROW(parser.parse(), sharg::user_input_error);
+}
+
+TEST(from_chars, paths_are_not_streamed)
+{
+    std::filesystem::path path{};
+    std::vector<std::filesystem::path> paths{};
+
+    const char * argv[] = {"./parser_test", "-p", "my file.fa", "\"quoted\".fa", "dir/b.fa"};
+    sharg::parser parser{"test_parser", 5, argv, sharg::update_notifications::off};
+    parser.add_option(path, 'p', "path", "A path.");
+    parser.add_positional_option(paths, "More paths.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(path, "my file.fa"); // white space is part of the path
+    EXPECT_EQ(paths, (std::vector<std::filesystem::path>{"\"quoted\".fa", "dir/b.fa"})); // quotes are kept
+}
@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+
+static constexpr sharg::option_schema schema{sharg::option_identifier{'i', "int"},
+                                             sharg::option_identifier{'s', "string"},
+                                             sharg::option_identifier{'f', "flag"},
+                                             sharg::option_identifier{'\0', "no-short-id"},
+                                             sharg::option_identifier{'l', ""}};
+
+TEST(option_schema, perfect_hash)
+{
+    static_assert(schema.find_long_id("int") == 0);
+    static_assert(schema.find_long_id("string") == 1);
+    static_assert(schema.find_long_id("flag") == 2);
+    static_assert(schema.find_long_id("no-short-id") == 3);
+    static_assert(schema.find_long_id("") == sharg::detail::option_schema_view::npos);
+    static_assert(schema.find_long_id("in") == sharg::detail::option_schema_view::npos);
+    static_assert(schema.find_long_id("strings") == sharg::detail::option_schema_view::npos);
+
+    EXPECT_EQ(schema.view().find_short_id('l'), 4u);
+    EXPECT_EQ(schema.view().find_short_id('x'), sharg::detail::option_schema_view::npos);
+}
+
+TEST(option_schema, large_schema)
+{
+    static constexpr sharg::option_schema large{sharg::option_identifier{'\0', "option-0"},
+                                                sharg::option_identifier{'\0', "option-1"},
+                                                sharg::option_identifier{'\0', "option-2"},
+                                                sharg::option_identifier{'\0', "option-3"},
+                                                sharg::option_identifier{'\0', "option-4"},
+                                                sharg::option_identifier{'\0', "option-5"},
+                                                sharg::option_identifier{'\0', "option-6"},
+                                                sharg::option_identifier{'\0', "option-7"},
+                                                sharg::option_identifier{'\0', "option-8"},
+                                                sharg::option_identifier{'\0', "option-9"},
+                                                sharg::option_identifier{'\0', "option-10"},
+                                                sharg::option_identifier{'\0', "option-11"}};
+
+    for (size_t i = 0; i < large.identifiers().size(); ++i)
+        EXPECT_EQ(large.find_long_id(large.identifiers()[i].long_id), i);
+}
+
+// Realistic long identifiers of a tool with many options (not a regular pattern like option-0, option-1, ...).
+TEST(option_schema, very_large_schema)
+{
+    using id = sharg::option_identifier;
+    static constexpr sharg::option_schema large{
+        id{'\0', "threads-format"}, id{'\0', "bin_width"}, id{'\0', "report-fraction"}, id{'\0', "level-length"},
+        id{'\0', "band-name"}, id{'\0', "input-suffix-extend"}, id{'\0', "band-count"}, id{'\0', "quality-rate"},
+        id{'\0', "write-merge-extend"}, id{'\0', "batch_region-bonus"}, id{'\0', "output-reference-length"},
+        id{'\0', "merge-type"}, id{'\0', "report-merge-ratio"}, id{'\0', "tag-count"}, id{'\0', "max-extend"},
+        id{'\0', "trace-ratio"}, id{'\0', "report_path"}, id{'\0', "clip_length"}, id{'\0', "batch-format"},
+        id{'\0', "trim_threshold"}, id{'\0', "suffix-count"}, id{'\0', "sort-count"}, id{'\0', "cache-path"},
+        id{'\0', "level-sample-penalty"}, id{'\0', "level-ratio"}, id{'\0', "threads-offset"},
+        id{'\0', "filter-trace-penalty"}, id{'\0', "max-policy"}, id{'\0', "output_target-fraction"},
+        id{'\0', "format-bonus"}, id{'\0', "max-length"}, id{'\0', "clip-length"}, id{'\0', "match-policy"},
+        id{'\0', "cache_quality-type"}, id{'\0', "seed_trace-width"}, id{'\0', "score-output-fraction"},
+        id{'\0', "region-score-depth"}, id{'\0', "input-score-open"}, id{'\0', "region-fraction"},
+        id{'\0', "gap-tag-format"}, id{'\0', "gap_fraction"}, id{'\0', "region-penalty"}, id{'\0', "keep-seed-count"},
+        id{'\0', "target_region-offset"}, id{'\0', "split-write-threshold"}, id{'\0', "bin-bonus"},
+        id{'\0', "sample-trim-size"}, id{'\0', "suffix_extend"}, id{'\0', "score_length"}, id{'\0', "sort-name"},
+        id{'\0', "threads-mode"}, id{'\0', "sort-trace-format"}, id{'\0', "score-depth"}, id{'\0', "trace-bonus"},
+        id{'\0', "match-penalty"}, id{'\0', "merge-file"}, id{'\0', "quality-policy"}, id{'\0', "threads-window"},
+        id{'\0', "region-dir"}, id{'\0', "band-dir"}, id{'\0', "seed_tag-count"}, id{'\0', "match_index-format"},
+        id{'\0', "memory-tag-penalty"}, id{'\0', "mismatch-size"}, id{'\0', "target_dir"}, id{'\0', "index-window"},
+        id{'\0', "read_window"}, id{'\0', "reference_type"}, id{'\0', "gap-name"}, id{'\0', "suffix-tag-path"},
+        id{'\0', "prefix-width"}, id{'\0', "sample-max-threshold"}, id{'\0', "read-depth"},
+        id{'\0', "index-input-path"}, id{'\0', "band_extend"}, id{'\0', "threads-extend"}, id{'\0', "report_size"},
+        id{'\0', "max-reference-type"}, id{'\0', "seed-format-window"}, id{'\0', "merge-bonus"}, id{'\0', "tag_path"},
+        id{'\0', "input_min-size"}, id{'\0', "memory-score-mode"}, id{'\0', "prefix-length"},
+        id{'\0', "merge-match-depth"}, id{'\0', "gap-dir"}, id{'\0', "quality-size"}, id{'\0', "sample-extend"},
+        id{'\0', "chunk-region-ratio"}, id{'\0', "memory-limit"}, id{'\0', "filter-path"},
+        id{'\0', "prefix_format-count"}, id{'\0', "bin-target-limit"}, id{'\0', "input-policy"},
+        id{'\0', "tag_ratio"}, id{'\0', "cache_bonus"}, id{'\0', "output_ratio"}, id{'\0', "output-merge-limit"},
+        id{'\0', "sample-mode"}, id{'\0', "band-penalty"}, id{'\0', "filter-type"}, id{'\0', "batch-mode"},
+        id{'\0', "skip-type"}, id{'\0', "seed-window"}, id{'\0', "sort-open"}, id{'\0', "level-width"},
+        id{'\0', "match-size"}, id{'\0', "max-name"}, id{'\0', "gap-file"}, id{'\0', "quality_size"},
+        id{'\0', "adapter-open"}, id{'\0', "score_window"}, id{'\0', "mismatch_penalty"}, id{'\0', "sort-trace-size"},
+        id{'\0', "cache-extend"}, id{'\0', "read-keep-bonus"}, id{'\0', "suffix-size"}, id{'\0', "trace_count"},
+        id{'\0', "target-dir"}, id{'\0', "clip_count"}, id{'\0', "keep-policy"}, id{'\0', "output-offset"},
+        id{'\0', "score-penalty"}, id{'\0', "level-merge-format"}, id{'\0', "trace-offset"}, id{'\0', "filter-width"},
+        id{'\0', "output-dir"}, id{'\0', "split-dir"}, id{'\0', "level-filter-threshold"}, id{'\0', "output-extend"},
+        id{'\0', "tag-open"}, id{'\0', "filter-memory-window"}, id{'\0', "mismatch-format"},
+        id{'\0', "adapter-seed-extend"}, id{'\0', "trace-size"}, id{'\0', "trace-threshold"},
+        id{'\0', "format-depth"}, id{'\0', "threads_threads-depth"}, id{'\0', "trace-length"},
+        id{'\0', "memory-penalty"}, id{'\0', "read_depth"}, id{'\0', "target-mode"}, id{'\0', "min-tag-offset"},
+        id{'\0', "tag_bonus"}, id{'\0', "mismatch-extend"}, id{'\0', "read_limit"}, id{'\0', "score-width"},
+        id{'\0', "clip_fraction"}, id{'\0', "split-mismatch-size"}, id{'\0', "output_width"},
+        id{'\0', "reference-dir"}, id{'\0', "trace-fraction"}, id{'\0', "chunk-path"}, id{'\0', "seed_open"},
+        id{'\0', "threads-sample-size"}, id{'\0', "score-size"}, id{'\0', "read-clip-limit"},
+        id{'\0', "split_length"}, id{'\0', "batch-dir"}, id{'\0', "level_rate"}};
+
+    static_assert(large.identifiers().size() >= 150);
+
+    for (size_t i = 0; i < large.identifiers().size(); ++i)
+        EXPECT_EQ(large.find_long_id(large.identifiers()[i].long_id), i);
+
+    EXPECT_EQ(large.find_long_id("threads-formats"), sharg::detail::option_schema_view::npos);
+    EXPECT_EQ(large.find_long_id("unknown-option"), sharg::detail::option_schema_view::npos);
+}
+
+TEST(option_schema, parse)
+{
+    int int_value{};
+    std::string string_value{};
+    bool flag_value{};
+    std::vector<int> list_value{};
+    int short_value{};
+
+    char const * argv[] = {"./parser_test", "--int", "5", "-s", "foo", "--no-short-id=1", "--flag",
+                           "--no-short-id", "2", "-l3"};
+    sharg::parser parser{"test_parser", 10, argv, schema, sharg::update_notifications::off};
+    parser.add_option(int_value, 'i', "int", "this is an int option.");
+    parser.add_option(string_value, 's', "string", "this is a string option.");
+    parser.add_flag(flag_value, 'f', "flag", "this is a flag.");
+    parser.add_option(list_value, '\0', "no-short-id", "this is a list option.");
+    parser.add_option(short_value, 'l', "", "this is an int option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(int_value, 5);
+    EXPECT_EQ(string_value, "foo");
+    EXPECT_TRUE(flag_value);
+    EXPECT_EQ(list_value, (std::vector<int>{1, 2}));
+    EXPECT_EQ(short_value, 3);
+
+    EXPECT_TRUE(parser.is_option_set("int"));
+    EXPECT_TRUE(parser.is_option_set('s'));
+    EXPECT_FALSE(parser.is_option_set("help"));
+    EXPECT_THROW(parser.is_option_set("unknown"), sharg::design_error);
+}
+
+TEST(option_schema, unknown_option)
+{
+    int int_value{};
+
+    char const * argv[] = {"./parser_test", "--int", "5", "--string", "foo"};
+    sharg::parser parser{"test_parser", 5, argv, schema, sharg::update_notifications::off};
+    parser.add_option(int_value, 'i', "int", "this is an int option.");
+
+    EXPECT_THROW(parser.parse(), sharg::unknown_option);
+}
+
+TEST(option_schema, design_error)
+{
+    int int_value{};
+    bool flag_value{};
+
+    char const * argv[] = {"./parser_test"};
+    sharg::parser parser{"test_parser", 1, argv, schema, sharg::update_notifications::off};
+
+    // not declared in the schema
+    EXPECT_THROW(parser.add_option(int_value, 'x', "xxx", "not declared."), sharg::design_error);
+    // declared, but with other identifiers
+    EXPECT_THROW(parser.add_option(int_value, 'x', "int", "wrong short id."), sharg::design_error);
+    EXPECT_THROW(parser.add_option(int_value, 'i', "", "missing long id."), sharg::design_error);
+    EXPECT_THROW(parser.add_flag(flag_value, 'f', "int", "mixed ids."), sharg::design_error);
+
+    EXPECT_NO_THROW(parser.add_option(int_value, 'i', "int", "this is an int option."));
+    // added twice
+    EXPECT_THROW(parser.add_option(int_value, 'i', "int", "this is an int option."), sharg::design_error);
+}
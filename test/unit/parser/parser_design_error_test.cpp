@@ -121,6 +121,32 @@ TEST(parse_test, parse_called_twice)
     EXPECT_THROW(parser.parse(), sharg::design_error);
 }
 
+TEST(parse_test, set_list_delimiter)
+{
+    std::vector<int> list_value{};
+    int int_value{};
+    bool flag_value{false};
+
+    const char * argv[] = {"./parser_test", "-l", "1,2"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(list_value, 'l', "list", "this is a list option.");
+    parser.add_option(int_value, 'i', "int", "this is an int option.");
+    parser.add_flag(flag_value, 'f', "flag", "this is a flag.");
+
+    EXPECT_NO_THROW(parser.set_list_delimiter('l', ','));
+    EXPECT_NO_THROW(parser.set_list_delimiter("list", ','));
+    EXPECT_THROW(parser.set_list_delimiter('l', '\0'), sharg::design_error); // invalid delimiter
+    EXPECT_THROW(parser.set_list_delimiter('i', ','), sharg::design_error);  // no list option
+    EXPECT_THROW(parser.set_list_delimiter("int", ','), sharg::design_error);
+    EXPECT_THROW(parser.set_list_delimiter('f', ','), sharg::design_error);  // flag
+    EXPECT_THROW(parser.set_list_delimiter('x', ','), sharg::design_error);  // unknown option
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(list_value, (std::vector<int>{1, 2}));
+
+    EXPECT_THROW(parser.set_list_delimiter('l', ','), sharg::design_error); // after parse()
+}
+
 TEST(parse_test, subcommand_parser_error)
 {
     bool flag_value{false};
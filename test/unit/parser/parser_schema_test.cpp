@@ -0,0 +1,182 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <sharg/parser_schema.hpp>
+#include <sharg/validators.hpp>
+
+struct parser_schema_test : public ::testing::Test
+{
+    parser_schema_test()
+    {
+        schema.add_option(int_value, 'i', "int", "this is an int option.", sharg::option_spec::required,
+                          sharg::arithmetic_range_validator{0, 10});
+        schema.add_option(list_value, 'l', "list", "this is a list option.");
+        schema.add_flag(flag_value, 'f', "flag", "this is a flag.");
+        schema.add_positional_option(positional_value, "this is a positional option.");
+    }
+
+    int int_value{3};
+    std::vector<std::string> list_value{};
+    bool flag_value{false};
+    std::string positional_value{"default"};
+
+    sharg::parser_schema schema{"test_parser"};
+};
+
+TEST_F(parser_schema_test, validate)
+{
+    EXPECT_TRUE(schema.validate({"./parser_test", "-i", "5", "-l", "a", "--list=b", "-f", "pos"}));
+    EXPECT_TRUE(schema.validate({"./parser_test", "pos", "--int=2"}));
+
+    // the bound variables are never modified
+    EXPECT_EQ(int_value, 3);
+    EXPECT_TRUE(list_value.empty());
+    EXPECT_FALSE(flag_value);
+    EXPECT_EQ(positional_value, "default");
+}
+
+TEST_F(parser_schema_test, errors)
+{
+    sharg::parse_result result = schema.validate({"./parser_test", "-i", "11", "pos"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+    EXPECT_EQ(result.argument_index(), 2u);
+
+    result = schema.validate({"./parser_test", "-i", "5"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::too_few_arguments);
+
+    result = schema.validate({"./parser_test", "pos"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::required_option_missing);
+
+    result = schema.validate({"./parser_test", "--version-check", "0", "-i", "5", "--unknown", "pos"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::unknown_option);
+    EXPECT_EQ(result.argument_index(), 5u);
+
+    result = schema.validate({"./parser_test", "--version-check", "maybe"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+
+    result = schema.validate({"./parser_test", "--export-help"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::too_few_arguments);
+}
+
+TEST_F(parser_schema_test, special_argument_errors_as_in_parser)
+{
+    auto expect_same_error = [this] (std::vector<char const *> const & argv)
+    {
+        sharg::parse_result result = schema.validate(static_cast<int>(argv.size()), argv.data());
+        EXPECT_FALSE(result.success());
+
+        try
+        {
+            sharg::parser parser{"test_parser", static_cast<int>(argv.size()), argv.data(),
+                                 sharg::update_notifications::off};
+            FAIL() << "sharg::parser did not throw.";
+        }
+        catch (sharg::parser_error const & ex)
+        {
+            EXPECT_EQ(result.message(), ex.what());
+        }
+    };
+
+    expect_same_error({"./parser_test", "--export-help"});
+    expect_same_error({"./parser_test", "--export-help", "pdf"});
+    expect_same_error({"./parser_test", "--export-help=pdf"});
+    expect_same_error({"./parser_test", "--version-check"});
+    expect_same_error({"./parser_test", "-i", "5", "--version-check", "maybe"});
+
+    EXPECT_EQ(schema.validate({"./parser_test", "-i", "5", "--export-help", "pdf"}).argument_index(), 3u);
+    EXPECT_EQ(schema.validate({"./parser_test", "-i", "5", "--version-check"}).argument_index(), 3u);
+    EXPECT_EQ(schema.validate({"./parser_test", "-i", "5", "--version-check", "maybe"}).argument_index(), 4u);
+}
+
+TEST_F(parser_schema_test, list_delimiter_and_sink)
+{
+    std::vector<int> ids{};
+    size_t sink_calls{0};
+
+    sharg::parser_schema list_schema{"test_parser"};
+    list_schema.add_option(ids, 'i', "ids", "this is a list option.", sharg::option_spec::standard,
+                           sharg::arithmetic_range_validator{0, 10});
+    list_schema.set_list_delimiter('i', ',');
+    list_schema.add_positional_option<int>([&sink_calls] (int &&) { ++sink_calls; }, "this is a sink.");
+
+    EXPECT_TRUE(list_schema.validate({"./parser_test", "--ids=1,2,3", "4", "5"}));
+
+    sharg::parse_result result = list_schema.validate({"./parser_test", "-i", "1,20", "4"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::validation_error);
+
+    result = list_schema.validate({"./parser_test", "-i", "1", "4", "x"});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_EQ(result.argument_index(), 4u);
+
+    EXPECT_EQ(sink_calls, 0u); // validate() never calls the sink
+    EXPECT_TRUE(ids.empty());
+
+    EXPECT_THROW(list_schema.set_list_delimiter('i', '\0'), sharg::design_error);
+    EXPECT_THROW(schema.set_list_delimiter('i', ','), sharg::design_error); // not a list option
+}
+
+TEST_F(parser_schema_test, same_result_as_try_parse)
+{
+    char const * argv[] = {"./parser_test", "-i", "abc", "pos"};
+
+    sharg::parser parser{"test_parser", 4, argv, sharg::update_notifications::off};
+    parser.add_option(int_value, 'i', "int", "this is an int option.", sharg::option_spec::required,
+                      sharg::arithmetic_range_validator{0, 10});
+    parser.add_positional_option(positional_value, "this is a positional option.");
+    sharg::parse_result expected = parser.try_parse();
+
+    sharg::parse_result result = schema.validate(4, argv);
+    EXPECT_EQ(result.kind(), expected.kind());
+    EXPECT_EQ(result.argument_index(), expected.argument_index());
+    EXPECT_EQ(result.option_id(), expected.option_id());
+    EXPECT_EQ(result.message(), expected.message());
+}
+
+TEST_F(parser_schema_test, special_formats_are_valid)
+{
+    EXPECT_TRUE(schema.validate({"./parser_test"}));
+    EXPECT_TRUE(schema.validate({"./parser_test", "-h"}));
+    EXPECT_TRUE(schema.validate({"./parser_test", "--version"}));
+    EXPECT_TRUE(schema.validate({"./parser_test", "--export-help=man"}));
+}
+
+TEST_F(parser_schema_test, design_errors)
+{
+    EXPECT_THROW(sharg::parser_schema{"test parser"}, sharg::design_error);
+    EXPECT_THROW(schema.add_option(int_value, 'i', "other", "duplicate short id."), sharg::design_error);
+
+    bool true_flag{true};
+    EXPECT_THROW(schema.add_flag(true_flag, 't', "true", "flags must default to false."), sharg::design_error);
+}
+
+TEST_F(parser_schema_test, concurrent_validate)
+{
+    std::vector<std::thread> threads{};
+    std::vector<size_t> failures(4, 0);
+
+    for (size_t t = 0; t < failures.size(); ++t)
+    {
+        threads.emplace_back([this, &failures, t] ()
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                std::string const value = std::to_string(i % 20); // values > 10 are invalid
+                failures[t] += !schema.validate({"./parser_test", "-i", value, "-f", "pos"}).success();
+            }
+        });
+    }
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    for (size_t const failure_count : failures)
+        EXPECT_EQ(failure_count, 90u);
+}
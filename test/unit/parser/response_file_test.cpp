@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sys/stat.h>
+
+#include <sharg/parser_schema.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+struct response_file_test : public ::testing::Test
+{
+    //!\brief Writes `content` to `file` and returns the argument `@<path>`.
+    std::string write(sharg::test::tmp_filename const & file, std::string const & content)
+    {
+        std::ofstream stream{file.get_path()};
+        stream << content;
+        return "@" + file.get_path().string();
+    }
+
+    sharg::test::tmp_filename file_1{"args_1.txt"};
+    sharg::test::tmp_filename file_2{"args_2.txt"};
+};
+
+TEST_F(response_file_test, expand)
+{
+    std::string const argument = write(file_1, "-i 5\n--name 'Skipper Kowalski'\n\nfile_1.fa file_2.fa\n");
+
+    int int_value{};
+    std::string name{};
+    std::vector<std::string> files{};
+
+    char const * argv[] = {"./parser_test", argument.c_str(), "file_3.fa"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(int_value, 'i', "int", "this is an int option.");
+    parser.add_option(name, 'n', "name", "this is a string option.");
+    parser.add_positional_option(files, "this is a positional option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(int_value, 5);
+    EXPECT_EQ(name, "Skipper Kowalski");
+    EXPECT_EQ(files, (std::vector<std::string>{"file_1.fa", "file_2.fa", "file_3.fa"}));
+}
+
+TEST_F(response_file_test, nested)
+{
+    std::string const inner = write(file_2, "-j 6");
+    std::string const outer = write(file_1, "-i 5 " + inner + " -k 7");
+
+    int i{}, j{}, k{};
+
+    char const * argv[] = {"./parser_test", outer.c_str()};
+    sharg::parser parser{"test_parser", 2, argv, sharg::update_notifications::off};
+    parser.add_option(i, 'i', "", "this is an int option.");
+    parser.add_option(j, 'j', "", "this is an int option.");
+    parser.add_option(k, 'k', "", "this is an int option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(i, 5);
+    EXPECT_EQ(j, 6);
+    EXPECT_EQ(k, 7);
+}
+
+TEST_F(response_file_test, same_file_twice)
+{
+    std::string const argument = write(file_1, "1 2");
+    std::vector<int> values{};
+
+    char const * argv[] = {"./parser_test", argument.c_str(), argument.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_positional_option(values, "this is a positional option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 1, 2}));
+}
+
+TEST_F(response_file_test, cycle)
+{
+    std::string const argument_1 = "@" + file_1.get_path().string();
+    std::string const argument_2 = write(file_2, "-i 5 " + argument_1);
+    write(file_1, argument_2);
+
+    char const * argv[] = {"./parser_test", argument_1.c_str()};
+    EXPECT_THROW((sharg::parser{"test_parser", 2, argv, sharg::update_notifications::off}), sharg::user_input_error);
+}
+
+TEST_F(response_file_test, unterminated_quote)
+{
+    std::string const argument = write(file_1, "-n 'Skipper");
+
+    char const * argv[] = {"./parser_test", argument.c_str()};
+    EXPECT_THROW((sharg::parser{"test_parser", 2, argv, sharg::update_notifications::off}), sharg::user_input_error);
+}
+
+TEST_F(response_file_test, not_a_file)
+{
+    std::vector<std::string> values{};
+
+    char const * argv[] = {"./parser_test", "@does_not_exist.txt", "@"};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_positional_option(values, "this is a positional option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(values, (std::vector<std::string>{"@does_not_exist.txt", "@"}));
+}
+
+TEST_F(response_file_test, not_a_regular_file)
+{
+    sharg::test::tmp_filename fifo{"fifo.txt"};
+    ASSERT_EQ(mkfifo(fifo.get_path().c_str(), 0644), 0);
+    std::string const fifo_argument = "@" + fifo.get_path().string();
+
+    // neither blocks
+    for (std::string const & argument : {fifo_argument, std::string{"@/dev/null"}})
+    {
+        char const * argv[] = {"./parser_test", argument.c_str()};
+        EXPECT_THROW((sharg::parser{"test_parser", 2, argv, sharg::update_notifications::off}),
+                     sharg::user_input_error);
+    }
+
+    int i{};
+    sharg::parser_schema schema{"test_parser"};
+    schema.add_option(i, 'i', "", "this is an int option.");
+
+    sharg::parse_result const result = schema.validate({"./parser_test", "-i", "5", fifo_argument});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_EQ(result.argument_index(), 3u);
+    EXPECT_NE(result.message().find("not a regular file"), std::string::npos);
+}
+
+TEST_F(response_file_test, end_of_options)
+{
+    std::string const argument = write(file_1, "-i 5");
+    std::string const nested = write(file_2, "-- " + argument);
+    int i{};
+    std::vector<std::string> values{};
+
+    char const * argv[] = {"./parser_test", "--", argument.c_str()};
+    sharg::parser parser{"test_parser", 3, argv, sharg::update_notifications::off};
+    parser.add_option(i, 'i', "", "this is an int option.");
+    parser.add_positional_option(values, "this is a positional option.");
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(i, 0);
+    EXPECT_EQ(values, (std::vector<std::string>{argument}));
+
+    sharg::parser_schema schema{"test_parser"};
+    schema.add_option(i, 'i', "", "this is an int option.", sharg::option_spec::required);
+    schema.add_positional_option(values, "this is a positional option.");
+
+    EXPECT_EQ(schema.validate({"./parser_test", "--", argument}).kind(),
+              sharg::parse_error_kind::required_option_missing);
+    EXPECT_EQ(schema.validate({"./parser_test", nested}).kind(), // `--` in a response file
+              sharg::parse_error_kind::required_option_missing);
+    EXPECT_TRUE(schema.validate({"./parser_test", argument, "--", argument}));
+}
+
+TEST_F(response_file_test, argument_index)
+{
+    std::string const argument = write(file_1, "-i 5 -j foo");
+    int i{}, j{};
+
+    char const * argv[] = {"./parser_test", "--version-check", "0", argument.c_str()};
+    sharg::parser parser{"test_parser", 4, argv, sharg::update_notifications::off};
+    parser.add_option(i, 'i', "", "this is an int option.");
+    parser.add_option(j, 'j', "", "this is an int option.");
+
+    sharg::parse_result const result = parser.try_parse();
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_EQ(result.argument_index(), 6u); // in the expanded command line
+}
+
+TEST_F(response_file_test, parser_schema)
+{
+    int i{}, j{};
+    sharg::parser_schema schema{"test_parser"};
+    schema.add_option(i, 'i', "", "this is an int option.", sharg::option_spec::required);
+    schema.add_option(j, 'j', "", "this is an int option.");
+
+    std::string const valid = write(file_1, "-i 5");
+    EXPECT_TRUE(schema.validate({"./parser_test", valid}));
+    EXPECT_TRUE(schema.validate({"./parser_test", "-j", "6", valid}));
+    EXPECT_EQ(schema.validate({"./parser_test", "-j", "6"}).kind(), sharg::parse_error_kind::required_option_missing);
+
+    sharg::parse_result result{};
+    {
+        std::string const invalid = write(file_2, "-i 5 -j foo");
+        result = schema.validate({"./parser_test", "--version-check", "0", invalid});
+    }
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_EQ(result.argument_index(), 6u); // in the expanded command line, like sharg::parser::try_parse
+    EXPECT_NE(result.message().find("foo"), std::string::npos); // the message outlives the response file
+
+    std::string const cycle = write(file_1, "-i 5 @" + file_1.get_path().string());
+    result = schema.validate({"./parser_test", cycle});
+    EXPECT_EQ(result.kind(), sharg::parse_error_kind::user_input_error);
+    EXPECT_NE(result.message().find("includes itself"), std::string::npos);
+}
@@ -0,0 +1,288 @@
+// -----------------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/sharg-parser/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <clocale>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <sharg/std/charconv>
+
+// The shim is only used by std::from_chars and std::to_chars if the standard library lacks the floating point
+// overloads, so it is tested directly here.
+namespace shim = sharg::contrib::charconv_float;
+
+template <typename value_t>
+struct parse_result
+{
+    value_t value;
+    std::errc ec;
+    size_t length;
+};
+
+template <typename value_t>
+parse_result<value_t> parse(std::string const & str,
+                            std::chars_format const fmt = std::chars_format::general,
+                            value_t const initial = value_t{42})
+{
+    value_t value{initial};
+    auto res = shim::from_chars_floating_point(str.data(), str.data() + str.size(), value, fmt);
+    return {value, res.ec, static_cast<size_t>(res.ptr - str.data())};
+}
+
+template <typename value_t>
+std::string print(value_t const value)
+{
+    char buffer[128];
+    auto res = shim::to_chars_floating_point(buffer, buffer + sizeof(buffer), value);
+    EXPECT_EQ(res.ec, std::errc{});
+    return {buffer, res.ptr};
+}
+
+// =============================================================================
+// from_chars_floating_point
+// =============================================================================
+
+template <typename T>
+class charconv_float_shim_test : public ::testing::Test
+{};
+
+using real_types = ::testing::Types<float, double, long double>;
+
+TYPED_TEST_SUITE(charconv_float_shim_test, real_types, );
+
+TYPED_TEST(charconv_float_shim_test, from_chars)
+{
+    EXPECT_EQ(parse<TypeParam>("1234").value, TypeParam{1234});
+    EXPECT_EQ(parse<TypeParam>("1.2e3").value, TypeParam{1200});
+    EXPECT_FLOAT_EQ(parse<TypeParam>("1.2e-3").value, TypeParam{0.0012L});
+    EXPECT_EQ(parse<TypeParam>("1.e2").value, TypeParam{100});
+    EXPECT_EQ(parse<TypeParam>("1.").value, TypeParam{1});
+    EXPECT_EQ(parse<TypeParam>(".2e3").value, TypeParam{200});
+    EXPECT_EQ(parse<TypeParam>("-.5").value, TypeParam{-0.5});
+    EXPECT_EQ(parse<TypeParam>("0000.000125e4").value, TypeParam{1.25});
+    EXPECT_FLOAT_EQ(parse<TypeParam>("3.14159265358979323846264338327950288").value, TypeParam{3.14159265358979323846L});
+
+    // the pattern ends before incomplete exponents and other characters
+    EXPECT_EQ(parse<TypeParam>("4em").length, 1u);
+    EXPECT_EQ(parse<TypeParam>("1.2e").length, 3u);
+    EXPECT_EQ(parse<TypeParam>("1.2e+").length, 3u);
+    EXPECT_EQ(parse<TypeParam>("3.19abc").length, 4u);
+
+    // negative zero
+    auto zero = parse<TypeParam>("-0.000e12");
+    EXPECT_EQ(zero.value, TypeParam{0});
+    EXPECT_TRUE(std::signbit(zero.value));
+    EXPECT_EQ(zero.length, 9u);
+}
+
+TYPED_TEST(charconv_float_shim_test, infinity_and_nan)
+{
+    for (std::string str : {"inf", "INF", "infinity", "InFiNiTy"})
+    {
+        EXPECT_EQ(parse<TypeParam>(str).value, std::numeric_limits<TypeParam>::infinity());
+        EXPECT_EQ(parse<TypeParam>("-" + str).value, -std::numeric_limits<TypeParam>::infinity());
+        EXPECT_EQ(parse<TypeParam>(str).length, str.size());
+    }
+
+    EXPECT_EQ(parse<TypeParam>("infinit").length, 3u);
+
+    for (std::string str : {"nan", "NAN", "nan(abc_123)", "-NaN()"})
+    {
+        EXPECT_TRUE(std::isnan(parse<TypeParam>(str).value));
+        EXPECT_EQ(parse<TypeParam>(str).length, str.size());
+    }
+
+    EXPECT_EQ(parse<TypeParam>("nan(abc").length, 3u);
+    EXPECT_EQ(parse<TypeParam>("nan(a-b)").length, 3u);
+}
+
+TYPED_TEST(charconv_float_shim_test, invalid_input)
+{
+    for (std::string str : {"", "-", ".", "-.e3", "e3", "+1.2e3", " 1", "x"})
+    {
+        auto res = parse<TypeParam>(str);
+        EXPECT_EQ(res.ec, std::errc::invalid_argument) << str;
+        EXPECT_EQ(res.length, 0u);
+        EXPECT_EQ(res.value, TypeParam{42});
+    }
+}
+
+TYPED_TEST(charconv_float_shim_test, out_of_range)
+{
+    for (std::string str : {"1e100000", "-1e100000", "1e-100000", "123456789e99999999999999999999"})
+    {
+        auto res = parse<TypeParam>(str);
+        EXPECT_EQ(res.ec, std::errc::result_out_of_range) << str;
+        EXPECT_EQ(res.length, str.size());
+        EXPECT_EQ(res.value, TypeParam{42}); // unchanged
+    }
+
+    // zero is not out of range, however small the exponent
+    EXPECT_EQ(parse<TypeParam>("0e-100000").ec, std::errc{});
+}
+
+TYPED_TEST(charconv_float_shim_test, chars_format)
+{
+    // fixed: no exponent
+    auto fixed = parse<TypeParam>("1.5e3", std::chars_format::fixed);
+    EXPECT_EQ(fixed.value, TypeParam{1.5});
+    EXPECT_EQ(fixed.length, 3u);
+
+    // scientific: exponent is required
+    EXPECT_EQ(parse<TypeParam>("1.5e3", std::chars_format::scientific).value, TypeParam{1500});
+    EXPECT_EQ(parse<TypeParam>("1.5", std::chars_format::scientific).ec, std::errc::invalid_argument);
+
+    // hex: without "0x" prefix
+    EXPECT_EQ(parse<TypeParam>("1.8p1", std::chars_format::hex).value, TypeParam{3});
+    EXPECT_EQ(parse<TypeParam>("-A.Bp-2", std::chars_format::hex).value, TypeParam{-2.671875});
+    EXPECT_EQ(parse<TypeParam>("ff", std::chars_format::hex).value, TypeParam{255});
+
+    auto prefixed = parse<TypeParam>("0x123", std::chars_format::hex);
+    EXPECT_EQ(prefixed.value, TypeParam{0});
+    EXPECT_EQ(prefixed.length, 1u);
+}
+
+TYPED_TEST(charconv_float_shim_test, locale_independent)
+{
+    // ',' is the decimal point in the German locale; the shim must not care
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr)
+        GTEST_SKIP() << "The German locale is not installed.";
+
+    EXPECT_EQ(parse<TypeParam>("2.5").value, TypeParam{2.5});
+    EXPECT_EQ(parse<TypeParam>("2,5").length, 1u);
+    EXPECT_EQ(print(TypeParam{2.5}), "2.5");
+
+    std::setlocale(LC_NUMERIC, "C");
+}
+
+TEST(charconv_float_shim_test, correct_rounding)
+{
+    // 2^53 + 1 is halfway between 2^53 and 2^53 + 2: ties to even
+    EXPECT_EQ(parse<double>("9007199254740993").value, 9007199254740992.0);
+    EXPECT_EQ(parse<double>("9007199254740993.00000000000000000000000000001").value, 9007199254740994.0);
+    EXPECT_EQ(parse<double>("9007199254740995").value, 9007199254740996.0);
+    EXPECT_EQ(parse<float>("1.00000005960464477539062499").value, 1.0f);
+    EXPECT_EQ(parse<float>("1.000000059604644775390625").value, 1.0f);
+    EXPECT_EQ(parse<float>("1.00000005960464477539062501").value, 1.00000011920928955078125f);
+
+    // subnormal numbers and the boundaries of the ranges
+    EXPECT_EQ(parse<double>("4.9406564584124654e-324").value, std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(parse<double>("2.4703282292062327e-324").ec, std::errc::result_out_of_range);
+    EXPECT_EQ(parse<double>("2.4703282292062328e-324").value, std::numeric_limits<double>::denorm_min());
+    EXPECT_EQ(parse<double>("2.2250738585072011e-308").value, 2.2250738585072009e-308);
+    EXPECT_EQ(parse<double>("1.7976931348623157e308").value, std::numeric_limits<double>::max());
+    EXPECT_EQ(parse<double>("1.7976931348623159e308").ec, std::errc::result_out_of_range);
+    EXPECT_EQ(parse<float>("1e-45").value, std::numeric_limits<float>::denorm_min());
+    EXPECT_EQ(parse<float>("3.4028235e38").value, std::numeric_limits<float>::max());
+    EXPECT_EQ(parse<float>("3.4028235677e38").value, std::numeric_limits<float>::max());
+    EXPECT_EQ(parse<float>("3.4028235678e38").ec, std::errc::result_out_of_range);
+
+    // hexadecimal subnormal numbers are rounded once
+    EXPECT_EQ(parse<float>("1.77d63bp-127", std::chars_format::hex).value, 0x1.77d63cp-127f);
+    EXPECT_EQ(parse<double>("0.c0f2beac18ec2cp-1022", std::chars_format::hex).value, 0x0.c0f2beac18ec3p-1022);
+    EXPECT_EQ(parse<double>("1.00000000000008000000000000001p0", std::chars_format::hex).value, 0x1.0000000000001p0);
+
+    // a number with many digits close to a tie needs all digits
+    std::string const halfway = "9007199254740993." + std::string(800, '0');
+    EXPECT_EQ(parse<double>(halfway).value, 9007199254740992.0);
+    EXPECT_EQ(parse<double>(halfway + "1").value, 9007199254740994.0);
+    EXPECT_EQ(parse<double>(halfway + "1e-2").value, 90071992547409.94);
+}
+
+// =============================================================================
+// to_chars_floating_point
+// =============================================================================
+
+TEST(charconv_float_shim_test, to_chars)
+{
+    EXPECT_EQ(print(120.25), "120.25");
+    EXPECT_EQ(print(0.1), "0.1");
+    EXPECT_EQ(print(0.1f), "0.1");
+    EXPECT_EQ(print(0.3), "0.3");
+    EXPECT_EQ(print(0.1 + 0.2), "0.30000000000000004");
+    EXPECT_EQ(print(-1.5), "-1.5");
+    EXPECT_EQ(print(100.0), "100");
+    EXPECT_EQ(print(1e-5), "1e-05");
+    EXPECT_EQ(print(0.0001), "1e-04");
+    EXPECT_EQ(print(0.001), "0.001"); // fixed notation wins a tie
+    EXPECT_EQ(print(1e23), "1e+23");
+    EXPECT_EQ(print(123456789.0), "123456789");
+    EXPECT_EQ(print(5e-324), "5e-324");
+    EXPECT_EQ(print(std::numeric_limits<double>::max()), "1.7976931348623157e+308");
+    EXPECT_EQ(print(std::numeric_limits<float>::max()), "3.4028235e+38");
+    EXPECT_EQ(print(std::numeric_limits<float>::denorm_min()), "1e-45");
+    EXPECT_EQ(print(3e-44f), "3e-44");
+    EXPECT_EQ(print(16777216.0f), "16777216");
+    EXPECT_EQ(print(0.0), "0");
+    EXPECT_EQ(print(-0.0f), "-0");
+    EXPECT_EQ(print(std::numeric_limits<double>::infinity()), "inf");
+    EXPECT_EQ(print(-std::numeric_limits<float>::infinity()), "-inf");
+    EXPECT_EQ(print(std::numeric_limits<double>::quiet_NaN()), "nan");
+
+    // large integers in fixed notation are printed exactly
+    EXPECT_EQ(print(1152921504606846976.0), "1152921504606846976");
+    EXPECT_EQ(print(79541493760.0f), "79541493760");
+
+    EXPECT_EQ(print(120.25L), "120.25");
+    EXPECT_EQ(print(0.1L), "0.1");
+    EXPECT_EQ(print(-2.5e-300L), "-2.5e-300");
+}
+
+TEST(charconv_float_shim_test, to_chars_buffer_too_small)
+{
+    char buffer[5];
+    EXPECT_EQ(shim::to_chars_floating_point(buffer, buffer + 5, 120.25).ec, std::errc::value_too_large);
+    EXPECT_EQ(shim::to_chars_floating_point(buffer, buffer + 5, 120.25).ptr, buffer + 5);
+    EXPECT_EQ(shim::to_chars_floating_point(buffer, buffer + 3, -1.0 / 0.0).ec, std::errc::value_too_large);
+
+    auto res = shim::to_chars_floating_point(buffer, buffer + 5, 1.625);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(std::string(buffer, res.ptr), "1.625");
+}
+
+// =============================================================================
+// round trips, compared to the standard library if it provides floating point overloads
+// =============================================================================
+
+template <typename value_t>
+void check_round_trips()
+{
+    using bits_t = std::conditional_t<sizeof(value_t) == 4, uint32_t, uint64_t>;
+    std::mt19937_64 generator{42};
+
+    for (size_t i = 0; i < 100'000; ++i)
+    {
+        value_t const value = std::bit_cast<value_t>(static_cast<bits_t>(generator()));
+
+        if (std::isnan(value))
+            continue;
+
+        std::string const str = print(value);
+        EXPECT_EQ(parse<value_t>(str).value, value) << str;
+
+#if __cpp_lib_to_chars >= 201611
+        char buffer[64];
+        auto res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        EXPECT_EQ(str, std::string(buffer, res.ptr));
+#endif
+    }
+}
+
+TEST(charconv_float_shim_test, round_trip_float)
+{
+    check_round_trips<float>();
+}
+
+TEST(charconv_float_shim_test, round_trip_double)
+{
+    check_round_trips<double>();
+}